@@ -105,7 +105,7 @@ Basic Types
 
 				static Unboxed<T> UnboxParameter(const Value& value, ITypeDescriptor* typeDescriptor, const WString& valueName)
 				{
-					return { new T(std::move(UnboxValue<T>(value, typeDescriptor, valueName))), true };
+					return Unboxed<T>(UnboxValue<T>(value, typeDescriptor, valueName));
 				}
 			};
 		}
@@ -18,6 +18,38 @@ namespace vl
 Functions
 ***********************************************************************/
 
+			namespace function_bridge_helper
+			{
+				template<typename T>
+				constexpr bool IsPlainValue = TypeInfoRetriver<std::remove_cvref_t<T>>::TypeFlag == TypeFlags::NonGenericType && TypeInfoRetriver<std::remove_cvref_t<T>>::Decorator == ITypeInfo::TypeDescriptor;
+
+				template<typename T>
+				ITypeDescriptor* GetPlainTypeDescriptor()
+				{
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+					if constexpr (IsPlainValue<T>)
+					{
+						return GetTypeDescriptor<std::remove_cvref_t<T>>();
+					}
+#endif
+					return nullptr;
+				}
+			}
+
+			inline Value InvokeFunctionProxy(const Ptr<IValueFunctionProxy>& proxy, ITypeDescriptor* const* argumentTypes)
+			{
+				return proxy->InvokeInPlace(ValueSpan());
+			}
+
+			template<typename ...TArguments>
+			Value InvokeFunctionProxy(const Ptr<IValueFunctionProxy>& proxy, ITypeDescriptor* const* argumentTypes, TArguments& ...arguments)
+			{
+				// arguments are boxed on the stack, the proxy decides whether to copy them or not
+				vint index = 0;
+				Value boxedArguments[] = { BoxParameter(arguments, argumentTypes[index++])... };
+				return proxy->InvokeInPlace(ValueSpan(boxedArguments));
+			}
+
 			template<typename R, typename ...TArgs>
 			struct ParameterAccessor<Func<R(TArgs...)>, TypeFlags::FunctionType>
 			{
@@ -46,12 +78,21 @@ Functions
 						}
 						else
 						{
-							return { new FunctionType([functionProxy](TArgs ...args)
+							// type descriptors are resolved once here, arguments are boxed on the stack for each call
+							ITypeDescriptor* argumentTypes[sizeof...(TArgs) == 0 ? 1 : sizeof...(TArgs)] = { function_bridge_helper::GetPlainTypeDescriptor<TArgs>()... };
+							ITypeDescriptor* returnType = function_bridge_helper::GetPlainTypeDescriptor<R>();
+							return { new FunctionType([functionProxy, argumentTypes, returnType](TArgs ...args)
 							{
-								Ptr<IValueList> arguments = IValueList::Create();
-								BoxParametersToList(arguments, std::forward<TArgs>(args)...);
-								auto result = functionProxy->Invoke(arguments);
-								if constexpr (!std::is_same_v<R, void>)
+								Value result = InvokeFunctionProxy(functionProxy, argumentTypes, args...);
+
+								if constexpr (std::is_same_v<R, void>)
+								{
+								}
+								else if constexpr (!std::is_reference_v<R> && function_bridge_helper::IsPlainValue<R>)
+								{
+									return UnboxValue<std::remove_cvref_t<R>>(result, returnType);
+								}
+								else
 								{
 									auto unboxed = description::UnboxParameter<std::remove_cvref_t<R>>(result);
 									if (std::is_reference_v<R>)
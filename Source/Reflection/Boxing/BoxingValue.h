@@ -149,28 +149,43 @@ Basic Types
 						typeDescriptor = GetTypeDescriptor<Type>();
 					}
 #endif
-					return Value::From(Ptr(new IValueType::TypedBox<Type>(object)), typeDescriptor);
+					if constexpr (pbt_selector::IsInlineType<Type>)
+					{
+						return Value::From<Type>(object, typeDescriptor);
+					}
+					else
+					{
+						return Value::From(Ptr(new IValueType::TypedBox<Type>(object)), typeDescriptor);
+					}
 				}
 
 				static T UnboxValue(const Value& value, ITypeDescriptor* typeDescriptor, const WString& valueName)
 				{
 					using Type = std::remove_cvref_t<T>;
-					if (auto unboxedValue = value.GetBoxedValue().Cast<IValueType::TypedBox<Type>>())
+					if constexpr (pbt_selector::IsInlineType<Type>)
 					{
-						return unboxedValue->value;
+						if (value.GetInlineBoxableType() == pbt_selector::Selector<Type>::Value)
+						{
+							return value.GetInlineValue<Type>();
+						}
 					}
 					else
 					{
-#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
-						if (!typeDescriptor)
+						if (auto unboxedValue = IValueType::TypedBox<Type>::From(value.GetBoxedValueRawPtr()))
 						{
-							typeDescriptor = GetTypeDescriptor<Type>();
+							return unboxedValue->value;
 						}
-						throw ArgumentTypeMismtatchException(valueName, typeDescriptor, Value::BoxedValue, value);
+					}
+
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+					if (!typeDescriptor)
+					{
+						typeDescriptor = GetTypeDescriptor<Type>();
+					}
+					throw ArgumentTypeMismtatchException(valueName, typeDescriptor, Value::BoxedValue, value);
 #else
-						CHECK_FAIL(L"vl::reflection::description::UnboxValue()#Argument type mismatch.");
+					CHECK_FAIL(L"vl::reflection::description::UnboxValue()#Argument type mismatch.");
 #endif
-					}
 				}
 			};
 
@@ -15,6 +15,34 @@ namespace vl
 		namespace description
 		{
 /***********************************************************************
+ConstructorAllocator
+***********************************************************************/
+
+			/// <summary>
+			/// Allocate objects for reflected constructors of a type.
+			/// Specialize it for a type before registering its constructors, to create objects from a custom allocator or object pool.
+			/// </summary>
+			/// <remarks>
+			/// A shared pointer still releases the object by <b>delete</b>,
+			/// so a type created from an object pool should also overload <b>operator delete</b>,
+			/// or only register constructors returning raw pointers.
+			/// </remarks>
+			/// <typeparam name="T">The type of created objects.</typeparam>
+			template<typename T>
+			struct ConstructorAllocator
+			{
+				/// <summary>Create an object.</summary>
+				/// <returns>The created object.</returns>
+				/// <typeparam name="R">The pointer type to return, which is T* or Ptr&lt;T&gt;.</typeparam>
+				/// <param name="args">Arguments for the constructor.</param>
+				template<typename R, typename ...TArgs>
+				static R New(TArgs&& ...args)
+				{
+					return R(new T(std::forward<TArgs>(args)...));
+				}
+			};
+
+/***********************************************************************
 UnboxAndCall
 ***********************************************************************/
 
@@ -70,46 +98,46 @@ UnboxAndCall
 					}
 
 					template<typename TFunction>
-					static auto AndCallFunction(TFunction function, IMethodInfo* methodInfo, collections::Array<Value>& arguments) -> decltype(function(std::declval<typename TArgPacks::TArg>()...))
+					static auto AndCallFunction(TFunction function, ITypeDescriptor* const* parameterTypes, ValueSpan arguments) -> decltype(function(std::declval<typename TArgPacks::TArg>()...))
 					{
 						// function(arguments)
 						return function(UnboxParameter<std::remove_cvref_t<typename TArgPacks::TArg>>(
 							arguments[TArgPacks::Index],
-							(methodInfo ? methodInfo->GetParameter(TArgPacks::Index)->GetType()->GetTypeDescriptor() : nullptr)
+							(parameterTypes ? parameterTypes[TArgPacks::Index] : nullptr)
 							).Ref()...);
 					}
 
 					template<typename TClass, typename TFunction>
-					static auto AndCallMethod(TFunction function, IMethodInfo* methodInfo, collections::Array<Value>& arguments, TClass* object) -> decltype((object->*function)(std::declval<typename TArgPacks::TArg>()...))
+					static auto AndCallMethod(TFunction function, ITypeDescriptor* const* parameterTypes, ValueSpan arguments, TClass* object) -> decltype((object->*function)(std::declval<typename TArgPacks::TArg>()...))
 					{
 						// (object->*function)(arguments)
 						return (object->*function)(UnboxParameter<std::remove_cvref_t<typename TArgPacks::TArg>>(
 							arguments[TArgPacks::Index],
-							(methodInfo ? methodInfo->GetParameter(TArgPacks::Index)->GetType()->GetTypeDescriptor() : nullptr)
+							(parameterTypes ? parameterTypes[TArgPacks::Index] : nullptr)
 							).Ref()...);
 					}
 
 					template<typename TClass, typename TFunction>
-					static auto AndCallExternal(TFunction function, IMethodInfo* methodInfo, collections::Array<Value>& arguments, TClass* object) -> decltype(function(object, std::declval<typename TArgPacks::TArg>()...))
+					static auto AndCallExternal(TFunction function, ITypeDescriptor* const* parameterTypes, ValueSpan arguments, TClass* object) -> decltype(function(object, std::declval<typename TArgPacks::TArg>()...))
 					{
 						// function(object, arguments)
 						return function(
 							object,
 							UnboxParameter<std::remove_cvref_t<typename TArgPacks::TArg>>(
 								arguments[TArgPacks::Index],
-								(methodInfo ? methodInfo->GetParameter(TArgPacks::Index)->GetType()->GetTypeDescriptor() : nullptr)
+								(parameterTypes ? parameterTypes[TArgPacks::Index] : nullptr)
 								).Ref()...
 							);
 					}
 
 					template<typename TClass, typename R>
-					static R AndNew(IMethodInfo* methodInfo, collections::Array<Value>& arguments)
+					static R AndNew(ITypeDescriptor* const* parameterTypes, ValueSpan arguments)
 					{
 						// new TClass(arguments)
-						return R(new TClass(UnboxParameter<std::remove_cvref_t<typename TArgPacks::TArg>>(
+						return ConstructorAllocator<TClass>::template New<R>(UnboxParameter<std::remove_cvref_t<typename TArgPacks::TArg>>(
 							arguments[TArgPacks::Index],
-							(methodInfo ? methodInfo->GetParameter(TArgPacks::Index)->GetType()->GetTypeDescriptor() : nullptr)
-							).Ref()...));
+							(parameterTypes ? parameterTypes[TArgPacks::Index] : nullptr)
+							).Ref()...);
 					}
 				};
 			}
@@ -121,50 +149,62 @@ Invoke
 			namespace invoke_helper
 			{
 				template<typename TClass, typename R, typename ...TArgs>
-				Value InvokeMethod(TClass* object, R(__thiscall TClass::* method)(TArgs...), IMethodInfo* methodInfo, collections::Array<Value>& arguments)
+				Value InvokeMethod(TClass* object, R(__thiscall TClass::* method)(TArgs...), ITypeDescriptor* const* parameterTypes, ITypeDescriptor* returnType, ValueSpan arguments)
 				{
 					using TArgPacks = MakeArgPacks<TArgs...>;
 					if constexpr (std::is_same_v<R, void>)
 					{
-						unboxcall_helper::Unbox<TArgPacks>::AndCallMethod(method, methodInfo, arguments, object);
+						unboxcall_helper::Unbox<TArgPacks>::AndCallMethod(method, parameterTypes, arguments, object);
 						return {};
 					}
 					else
 					{
-						auto td = methodInfo ? methodInfo->GetReturn()->GetTypeDescriptor() : nullptr;
-						return BoxParameter(unboxcall_helper::Unbox<TArgPacks>::AndCallMethod(method, methodInfo, arguments, object), td);
+						return BoxParameter(unboxcall_helper::Unbox<TArgPacks>::AndCallMethod(method, parameterTypes, arguments, object), returnType);
 					}
 				}
 
 				template<typename TClass, typename R, typename ...TArgs>
-				Value InvokeExternal(TClass* object, R(*method)(TClass*, TArgs...), IMethodInfo* methodInfo, collections::Array<Value>& arguments)
+				Value InvokeExternal(TClass* object, R(*method)(TClass*, TArgs...), ITypeDescriptor* const* parameterTypes, ITypeDescriptor* returnType, ValueSpan arguments)
 				{
 					using TArgPacks = MakeArgPacks<TArgs...>;
 					if constexpr (std::is_same_v<R, void>)
 					{
-						unboxcall_helper::Unbox<TArgPacks>::AndCallExternal(method, methodInfo, arguments, object);
+						unboxcall_helper::Unbox<TArgPacks>::AndCallExternal(method, parameterTypes, arguments, object);
 						return {};
 					}
 					else
 					{
-						auto td = methodInfo ? methodInfo->GetReturn()->GetTypeDescriptor() : nullptr;
-						return BoxParameter(unboxcall_helper::Unbox<TArgPacks>::AndCallExternal(method, methodInfo, arguments, object), td);
+						return BoxParameter(unboxcall_helper::Unbox<TArgPacks>::AndCallExternal(method, parameterTypes, arguments, object), returnType);
 					}
 				}
 
 				template<typename R, typename ...TArgs>
-				Value InvokeFunction(R(*method)(TArgs...), IMethodInfo* methodInfo, collections::Array<Value>& arguments)
+				Value InvokeFunction(R(*method)(TArgs...), ITypeDescriptor* const* parameterTypes, ITypeDescriptor* returnType, ValueSpan arguments)
 				{
 					using TArgPacks = MakeArgPacks<TArgs...>;
 					if constexpr (std::is_same_v<R, void>)
 					{
-						unboxcall_helper::Unbox<TArgPacks>::AndCallFunction(method, methodInfo, arguments);
+						unboxcall_helper::Unbox<TArgPacks>::AndCallFunction(method, parameterTypes, arguments);
 						return {};
 					}
 					else
 					{
-						auto td = methodInfo ? methodInfo->GetReturn()->GetTypeDescriptor() : nullptr;
-						return BoxParameter(unboxcall_helper::Unbox<TArgPacks>::AndCallFunction(method, methodInfo, arguments), td);
+						return BoxParameter(unboxcall_helper::Unbox<TArgPacks>::AndCallFunction(method, parameterTypes, arguments), returnType);
+					}
+				}
+
+				template<typename TFunction, typename ...TArgs>
+				Value InvokeObject(TFunction& function, ITypeDescriptor* const* parameterTypes, ITypeDescriptor* returnType, ValueSpan arguments)
+				{
+					using TArgPacks = MakeArgPacks<TArgs...>;
+					if constexpr (std::is_same_v<decltype(function(std::declval<TArgs>()...)), void>)
+					{
+						unboxcall_helper::Unbox<TArgPacks>::template AndCallFunction<TFunction&>(function, parameterTypes, arguments);
+						return {};
+					}
+					else
+					{
+						return BoxParameter(unboxcall_helper::Unbox<TArgPacks>::template AndCallFunction<TFunction&>(function, parameterTypes, arguments), returnType);
 					}
 				}
 
@@ -5,6 +5,8 @@ Licensed under https://github.com/vczh-libraries/License
 
 #include "DescriptableInterfaces.h"
 #include "./Reflection/Reflection.h"
+#include <chrono>
+#include <exception>
 
 namespace vl
 {
@@ -14,16 +16,491 @@ namespace vl
 	{
 		namespace description
 		{
+/***********************************************************************
+BoxedValuePool
+***********************************************************************/
+
+#ifdef VCZH_CHECK_MEMORY_LEAKS_NEW
+#undef new
+#endif
+
+#ifndef VCZH_REFLECTION_NO_BOXED_VALUE_POOL
+
+			// a pool is trivially destructible, so it is still accessible
+			// when boxed values are released during destruction of other thread_local or global variables
+			struct BoxedValuePool
+			{
+				// blocks are grouped by size in steps of BlockAlignment, larger blocks are not pooled
+				static constexpr size_t			BlockAlignment = 16;
+				static constexpr vint			SizeClassCount = 16;
+				static constexpr vint			MaxFreeBlocks = 1024;
+
+				struct FreeBlock
+				{
+					FreeBlock*					next;
+				};
+
+				FreeBlock*						freeBlocks[SizeClassCount] = { 0 };
+				vint							freeCounts[SizeClassCount] = { 0 };
+				BoxedValuePoolStatistics		statistics;
+
+				// free blocks are only accessed by the owner thread, except when they are drained by DrainBoxedValuePools
+				std::atomic<bool>				locked = false;
+				bool							registered = false;
+				bool							exited = false;
+				BoxedValuePool*					previous = nullptr;
+				BoxedValuePool*					next = nullptr;
+
+				static vint GetSizeClass(size_t size)
+				{
+					vint sizeClass = (vint)((size + BlockAlignment - 1) / BlockAlignment) - 1;
+					return sizeClass < SizeClassCount ? sizeClass : -1;
+				}
+
+				void Lock()
+				{
+					while (locked.exchange(true, std::memory_order_acquire));
+				}
+
+				void Unlock()
+				{
+					locked.store(false, std::memory_order_release);
+				}
+
+				void FreeBlocks()
+				{
+					for (vint i = 0; i < SizeClassCount; i++)
+					{
+						while (auto block = freeBlocks[i])
+						{
+							freeBlocks[i] = block->next;
+							::operator delete(block);
+						}
+						freeCounts[i] = 0;
+					}
+				}
+			};
+			static_assert(std::is_trivially_destructible_v<BoxedValuePool>);
+
+			struct BoxedValuePoolExit
+			{
+				BoxedValuePool*					pool = nullptr;
+
+				~BoxedValuePoolExit();
+			};
+
+			SpinLock							boxedValuePoolsLock;
+			BoxedValuePool*						boxedValuePools = nullptr;
+			std::atomic<bool>					boxedValuePoolEnabled = true;
+			thread_local BoxedValuePool			boxedValuePool;
+			thread_local BoxedValuePoolExit		boxedValuePoolExit;
+
+			BEGIN_GLOBAL_STORAGE_CLASS(BoxedValuePoolStorage)
+			INITIALIZE_GLOBAL_STORAGE_CLASS
+				boxedValuePoolEnabled = true;
+			FINALIZE_GLOBAL_STORAGE_CLASS
+				// blocks cached in any thread would be reported as memory leaks after global storages are finalized
+				boxedValuePoolEnabled = false;
+				DrainBoxedValuePools();
+			END_GLOBAL_STORAGE_CLASS(BoxedValuePoolStorage)
+
+			BoxedValuePoolExit::~BoxedValuePoolExit()
+			{
+				// thread_local variables in the same file could be initialized together, even if the pool is never used in this thread
+				if (!pool) return;
+
+				// the pool stops caching blocks after the thread exits
+				SPIN_LOCK(boxedValuePoolsLock)
+				{
+					if (pool->previous) pool->previous->next = pool->next; else boxedValuePools = pool->next;
+					if (pool->next) pool->next->previous = pool->previous;
+				}
+				pool->Lock();
+				pool->exited = true;
+				pool->FreeBlocks();
+				pool->Unlock();
+			}
+
+			BoxedValuePool& GetBoxedValuePool()
+			{
+				auto& pool = boxedValuePool;
+				if (!pool.registered)
+				{
+					pool.registered = true;
+					// accessing boxedValuePoolExit registers its destructor for the current thread
+					boxedValuePoolExit.pool = &pool;
+					SPIN_LOCK(boxedValuePoolsLock)
+					{
+						GetBoxedValuePoolStorage();
+						pool.next = boxedValuePools;
+						if (boxedValuePools) boxedValuePools->previous = &pool;
+						boxedValuePools = &pool;
+					}
+				}
+				return pool;
+			}
+
+			void* AllocateBoxedValue(size_t size)
+			{
+				auto& pool = GetBoxedValuePool();
+				pool.statistics.allocations++;
+				vint sizeClass = BoxedValuePool::GetSizeClass(size);
+				if (sizeClass == -1)
+				{
+					return ::operator new(size);
+				}
+
+				pool.Lock();
+				if (auto block = pool.freeBlocks[sizeClass])
+				{
+					pool.freeBlocks[sizeClass] = block->next;
+					pool.freeCounts[sizeClass]--;
+					pool.Unlock();
+					pool.statistics.hits++;
+					return block;
+				}
+				pool.Unlock();
+				return ::operator new((sizeClass + 1) * BoxedValuePool::BlockAlignment);
+			}
+
+			void DeallocateBoxedValue(void* memory, size_t size)
+			{
+				auto& pool = GetBoxedValuePool();
+				pool.statistics.deallocations++;
+				vint sizeClass = BoxedValuePool::GetSizeClass(size);
+				if (sizeClass != -1)
+				{
+					// checked inside the lock, so that no block is cached after DrainBoxedValuePools is called by FinalizeGlobalStorage
+					// a block could be returned to a pool in a different thread, which is fine since all blocks come from ::operator new
+					pool.Lock();
+					bool pooling = !pool.exited && boxedValuePoolEnabled && pool.freeCounts[sizeClass] < BoxedValuePool::MaxFreeBlocks;
+					if (pooling)
+					{
+						auto block = (BoxedValuePool::FreeBlock*)memory;
+						block->next = pool.freeBlocks[sizeClass];
+						pool.freeBlocks[sizeClass] = block;
+						pool.freeCounts[sizeClass]++;
+					}
+					pool.Unlock();
+
+					if (pooling)
+					{
+						pool.statistics.recycles++;
+						return;
+					}
+				}
+				::operator delete(memory);
+			}
+
+			void DrainBoxedValuePools()
+			{
+				SPIN_LOCK(boxedValuePoolsLock)
+				{
+					for (auto pool = boxedValuePools; pool; pool = pool->next)
+					{
+						pool->Lock();
+						pool->FreeBlocks();
+						pool->Unlock();
+					}
+				}
+			}
+
+			BoxedValuePoolStatistics GetBoxedValuePoolStatistics()
+			{
+				return boxedValuePool.statistics;
+			}
+
+			void ResetBoxedValuePoolStatistics()
+			{
+				boxedValuePool.statistics = {};
+			}
+
+#else
+
+			void* AllocateBoxedValue(size_t size)
+			{
+				return ::operator new(size);
+			}
+
+			void DeallocateBoxedValue(void* memory, size_t size)
+			{
+				::operator delete(memory);
+			}
+
+			void DrainBoxedValuePools()
+			{
+			}
+
+			BoxedValuePoolStatistics GetBoxedValuePoolStatistics()
+			{
+				return {};
+			}
+
+			void ResetBoxedValuePoolStatistics()
+			{
+			}
+
+#endif
+
+#ifdef VCZH_CHECK_MEMORY_LEAKS_NEW
+#define new VCZH_CHECK_MEMORY_LEAKS_NEW
+#endif
+
+/***********************************************************************
+IPropertyInfo
+***********************************************************************/
+
+			Value IPropertyInfo::GetValueUnchecked(const Value& thisObject)
+			{
+				return GetValue(thisObject);
+			}
+
+			void IPropertyInfo::SetValueUnchecked(Value& thisObject, const Value& newValue)
+			{
+				SetValue(thisObject, newValue);
+			}
+
+			bool IPropertyInfo::QueryNativeGetter(const std::type_info& signature, void* invoker)
+			{
+				return false;
+			}
+
+			bool IPropertyInfo::QueryNativeSetter(const std::type_info& signature, void* invoker)
+			{
+				return false;
+			}
+
+/***********************************************************************
+IMethodInfo
+***********************************************************************/
+
+			void CopyArguments(ValueSpan arguments, collections::Array<Value>& copied)
+			{
+				copied.Resize(arguments.Count());
+				for (vint i = 0; i < arguments.Count(); i++)
+				{
+					copied[i] = arguments[i];
+				}
+			}
+
+			void IMethodInfo::CheckArgumentsInPlace(ValueSpan arguments)
+			{
+				collections::Array<Value> copied;
+				CopyArguments(arguments, copied);
+				CheckArguments(copied);
+			}
+
+			Value IMethodInfo::InvokeInPlace(const Value& thisObject, ValueSpan arguments)
+			{
+				collections::Array<Value> copied;
+				CopyArguments(arguments, copied);
+				return Invoke(thisObject, copied);
+			}
+
+			vint IMethodInfo::TryCheckArguments(ValueSpan arguments)
+			{
+				try
+				{
+					CheckArgumentsInPlace(arguments);
+					return 0;
+				}
+				catch (const TypeDescriptorException&)
+				{
+					return -1;
+				}
+			}
+
+			Value IMethodInfo::InvokeUnchecked(const Value& thisObject, ValueSpan arguments)
+			{
+				return InvokeInPlace(thisObject, arguments);
+			}
+
+			bool IMethodInfo::QueryNativeInvoker(const std::type_info& signature, void* invoker)
+			{
+				return false;
+			}
+
+/***********************************************************************
+ITypeManager
+***********************************************************************/
+
+#ifndef VCZH_DEBUG_NO_REFLECTION
+
+			vint ITypeManager::SetTypeDescriptors(const collections::List<Ptr<ITypeDescriptor>>& typeDescriptors)
+			{
+				vint added = 0;
+				for (vint i = 0; i < typeDescriptors.Count(); i++)
+				{
+					auto typeDescriptor = typeDescriptors[i];
+					if (typeDescriptor && SetTypeDescriptor(typeDescriptor->GetTypeName(), typeDescriptor))
+					{
+						added++;
+					}
+				}
+				return added;
+			}
+
+#endif
+
 /***********************************************************************
 description::TypeManager
 ***********************************************************************/
 
 #ifndef VCZH_DEBUG_NO_REFLECTION
 
+			class TypeNameIndex : public Object
+			{
+			protected:
+				struct Entry
+				{
+					vuint64_t									hash = 0;
+					WString										name;
+					ITypeDescriptor*							type = nullptr;
+				};
+
+				// open addressing with linear probing, the table is at most half full so that probing always stops at an empty entry
+				Array<Entry>									entries;
+				vuint64_t										mask = 0;
+
+				static vuint64_t Hash(const WString& name)
+				{
+					// FNV-1a
+					vuint64_t hash = 14695981039346656037ULL;
+					auto buffer = name.Buffer();
+					for (vint i = 0; i < name.Length(); i++)
+					{
+						hash ^= (vuint64_t)buffer[i];
+						hash *= 1099511628211ULL;
+					}
+					return hash;
+				}
+
+			public:
+				TypeNameIndex(const Dictionary<WString, Ptr<ITypeDescriptor>>& typeDescriptors)
+				{
+					vint capacity = 16;
+					while (capacity < typeDescriptors.Count() * 2)
+					{
+						capacity *= 2;
+					}
+					entries.Resize(capacity);
+					mask = (vuint64_t)capacity - 1;
+
+					auto&& keys = typeDescriptors.Keys();
+					auto&& values = typeDescriptors.Values();
+					for (vint i = 0; i < keys.Count(); i++)
+					{
+						auto hash = Hash(keys[i]);
+						auto slot = hash & mask;
+						while (entries[(vint)slot].type)
+						{
+							slot = (slot + 1) & mask;
+						}
+						auto& entry = entries[(vint)slot];
+						entry.hash = hash;
+						entry.name = keys[i];
+						entry.type = values[i].Obj();
+					}
+				}
+
+				ITypeDescriptor* Find(const WString& name)const
+				{
+					auto hash = Hash(name);
+					auto slot = hash & mask;
+					while (true)
+					{
+						auto& entry = entries[(vint)slot];
+						if (!entry.type) return nullptr;
+						if (entry.hash == hash && entry.name == name) return entry.type;
+						slot = (slot + 1) & mask;
+					}
+				}
+			};
+
+			namespace type_name_index_readers
+			{
+				// each thread reading a TypeNameIndex owns a record, which is marked by the current epoch during reading
+				// readers only write to their own records, so they do not contend with each other
+				struct Record
+				{
+					atomic_vint									epoch = 0;
+					bool										registered = false;
+					Record*										previous = nullptr;
+					Record*										next = nullptr;
+
+					~Record();
+				};
+
+				atomic_vint										currentEpoch = 1;
+				SpinLock										recordsLock;
+				Record*											records = nullptr;
+				thread_local Record								threadRecord;
+
+				Record::~Record()
+				{
+					if (!registered) return;
+					SPIN_LOCK(recordsLock)
+					{
+						if (previous) previous->next = next; else records = next;
+						if (next) next->previous = previous;
+					}
+				}
+
+				class Reading
+				{
+				public:
+					Reading()
+					{
+						auto& record = threadRecord;
+						if (!record.registered)
+						{
+							record.registered = true;
+							SPIN_LOCK(recordsLock)
+							{
+								record.next = records;
+								if (records) records->previous = &record;
+								records = &record;
+							}
+						}
+
+						// the epoch is marked before the published index is loaded
+						// so an index retired after this reader starts is never freed while reading
+						record.epoch = currentEpoch.load();
+					}
+
+					~Reading()
+					{
+						threadRecord.epoch = 0;
+					}
+				};
+
+				vint Retire()
+				{
+					return currentEpoch++;
+				}
+
+				vint GetOldestReadingEpoch()
+				{
+					vint oldest = currentEpoch;
+					SPIN_LOCK(recordsLock)
+					{
+						for (auto record = records; record; record = record->next)
+						{
+							vint epoch = record->epoch;
+							if (epoch != 0 && epoch < oldest)
+							{
+								oldest = epoch;
+							}
+						}
+					}
+					return oldest;
+				}
+			}
+
 			class TypeManager : public Object, public ITypeManager
 			{
 			public:
-				static vint										typeVersion;
+				static atomic_vint								typeVersion;
 
 			protected:
 				Dictionary<WString, Ptr<ITypeDescriptor>>		typeDescriptors;
@@ -31,9 +508,75 @@ description::TypeManager
 				ITypeDescriptor*								rootType = nullptr;
 				bool											loaded = false;
 
+				// the published index is immutable and always available, readers load it without locking
+				// a retired index is kept with the epoch it is retired, until all reading threads are marked by newer epochs
+				// while type loaders are running, other threads keep reading the last published index
+				std::atomic<TypeNameIndex*>						typeNameIndex = nullptr;
+				Ptr<TypeNameIndex>								publishedTypeNameIndex;
+				List<Pair<vint, Ptr<TypeNameIndex>>>			retiredTypeNameIndices;
+				atomic_vint										typeNameIndexUpdatingThread = -1;
+				vint											typeNameIndexSuspended = 0;
+
+				void ReclaimTypeNameIndices()
+				{
+					// a reader marked by an epoch could only load indices retired in the same epoch or later
+					vint oldest = type_name_index_readers::GetOldestReadingEpoch();
+					for (vint i = retiredTypeNameIndices.Count() - 1; i >= 0; i--)
+					{
+						if (retiredTypeNameIndices[i].key < oldest)
+						{
+							retiredTypeNameIndices.RemoveAt(i);
+						}
+					}
+				}
+
+				void UpdateTypeNameIndex()
+				{
+					if (typeNameIndexSuspended == 0)
+					{
+						auto index = Ptr(new TypeNameIndex(typeDescriptors));
+						typeNameIndex.store(index.Obj());
+						if (publishedTypeNameIndex)
+						{
+							retiredTypeNameIndices.Add({ type_name_index_readers::Retire(), publishedTypeNameIndex });
+						}
+						publishedTypeNameIndex = index;
+						ReclaimTypeNameIndices();
+					}
+				}
+
+				void ResumeTypeNameIndex()
+				{
+					if (--typeNameIndexSuspended == 0)
+					{
+						UpdateTypeNameIndex();
+						typeNameIndexUpdatingThread = -1;
+					}
+				}
+
+				template<typename TCallback>
+				void UpdateTypeNameIndexAfter(TCallback&& callback)
+				{
+					if (typeNameIndexSuspended++ == 0)
+					{
+						typeNameIndexUpdatingThread = Thread::GetCurrentThreadId();
+					}
+					try
+					{
+						callback();
+					}
+					catch (...)
+					{
+						ResumeTypeNameIndex();
+						throw;
+					}
+					ResumeTypeNameIndex();
+				}
+
 			public:
 				TypeManager()
 				{
+					UpdateTypeNameIndex();
 				}
 
 				~TypeManager()
@@ -53,8 +596,15 @@ description::TypeManager
 
 				ITypeDescriptor* GetTypeDescriptor(const WString& name)override
 				{
-					vint index = typeDescriptors.Keys().IndexOf(name);
-					return index == -1 ? 0 : typeDescriptors.Values().Get(index).Obj();
+					// the thread running type loaders sees types registered after the last published index
+					if (typeNameIndexUpdatingThread == Thread::GetCurrentThreadId())
+					{
+						vint index = typeDescriptors.Keys().IndexOf(name);
+						return index == -1 ? 0 : typeDescriptors.Values().Get(index).Obj();
+					}
+
+					type_name_index_readers::Reading reading;
+					return typeNameIndex.load()->Find(name);
 				}
 
 				bool SetTypeDescriptor(const WString& name, Ptr<ITypeDescriptor> typeDescriptor)override
@@ -68,6 +618,7 @@ description::TypeManager
 						if (typeDescriptor)
 						{
 							typeDescriptors.Add(name, typeDescriptor);
+							UpdateTypeNameIndex();
 							typeVersion++;
 							return true;
 						}
@@ -77,6 +628,7 @@ description::TypeManager
 						if (!typeDescriptor)
 						{
 							typeDescriptors.Remove(name);
+							UpdateTypeNameIndex();
 							typeVersion++;
 							return true;
 						}
@@ -84,6 +636,59 @@ description::TypeManager
 					return false;
 				}
 
+				vint SetTypeDescriptors(const List<Ptr<ITypeDescriptor>>& newTypeDescriptors)override
+				{
+					// sort indices instead of types, so that the first one wins among types with the same name
+					List<vint> order;
+					for (vint i = 0; i < newTypeDescriptors.Count(); i++)
+					{
+						if (newTypeDescriptors[i])
+						{
+							order.Add(i);
+						}
+					}
+					if (order.Count() == 0) return 0;
+
+					Sort(&order[0], order.Count(), [&](vint a, vint b)
+					{
+						auto result = newTypeDescriptors[a]->GetTypeName() <=> newTypeDescriptors[b]->GetTypeName();
+						return result != 0 ? result : a <=> b;
+					});
+
+					// merge both sorted sequences, adding in ascending order always appends to the dictionary
+					Dictionary<WString, Ptr<ITypeDescriptor>> merged;
+					auto&& oldKeys = typeDescriptors.Keys();
+					auto&& oldValues = typeDescriptors.Values();
+					vint oldIndex = 0;
+					vint added = 0;
+					for (vint i = 0; i < order.Count(); i++)
+					{
+						auto&& typeDescriptor = newTypeDescriptors[order[i]];
+						auto&& name = typeDescriptor->GetTypeName();
+						while (oldIndex < oldKeys.Count() && oldKeys[oldIndex] < name)
+						{
+							merged.Add(oldKeys[oldIndex], oldValues[oldIndex]);
+							oldIndex++;
+						}
+						if (oldIndex < oldKeys.Count() && oldKeys[oldIndex] == name) continue;
+						if (i > 0 && newTypeDescriptors[order[i - 1]]->GetTypeName() == name) continue;
+						merged.Add(name, typeDescriptor);
+						added++;
+					}
+					for (; oldIndex < oldKeys.Count(); oldIndex++)
+					{
+						merged.Add(oldKeys[oldIndex], oldValues[oldIndex]);
+					}
+
+					if (added > 0)
+					{
+						typeDescriptors = std::move(merged);
+						UpdateTypeNameIndex();
+						typeVersion++;
+					}
+					return added;
+				}
+
 				bool AddTypeLoader(Ptr<ITypeLoader> typeLoader)override
 				{
 					vint index = typeLoaders.IndexOf(typeLoader.Obj());
@@ -92,9 +697,11 @@ description::TypeManager
 						typeLoaders.Add(typeLoader);
 						if (loaded)
 						{
-							auto oldTypeVersion = typeVersion;
-							typeLoader->Load(this);
-							typeVersion = oldTypeVersion + 1;
+							UpdateTypeNameIndexAfter([&]()
+							{
+								typeLoader->Load(this);
+							});
+							typeVersion++;
 						}
 						return true;
 					}
@@ -111,9 +718,11 @@ description::TypeManager
 					{
 						if (loaded)
 						{
-							auto oldTypeVersion = typeVersion;
-							typeLoader->Unload(this);
-							typeVersion = oldTypeVersion + 1;
+							UpdateTypeNameIndexAfter([&]()
+							{
+								typeLoader->Unload(this);
+							});
+							typeVersion++;
 						}
 						typeLoaders.RemoveAt(index);
 						return true;
@@ -129,13 +738,16 @@ description::TypeManager
 					if (!loaded)
 					{
 						loaded = true;
-						auto oldTypeVersion = typeVersion;
-						// TODO: (enumerable) foreach
-						for (vint i = 0; i < typeLoaders.Count(); i++)
+						UpdateTypeNameIndexAfter([&]()
 						{
-							typeLoaders[i]->Load(this);
-						}
-						typeVersion = oldTypeVersion + 1;
+							// TODO: (enumerable) foreach
+							for (vint i = 0; i < typeLoaders.Count(); i++)
+							{
+								typeLoaders[i]->Load(this);
+							}
+						});
+						// versions never go back, so that a type descriptor cached during loading is not mistaken as up to date
+						typeVersion++;
 						return true;
 					}
 					else
@@ -150,14 +762,16 @@ description::TypeManager
 					{
 						loaded = false;
 						rootType = 0;
-						auto oldTypeVersion = typeVersion;
-						// TODO: (enumerable) foreach
-						for (vint i = 0; i < typeLoaders.Count(); i++)
+						UpdateTypeNameIndexAfter([&]()
 						{
-							typeLoaders[i]->Unload(this);
-						}
-						typeVersion = oldTypeVersion + 1;
-						typeDescriptors.Clear();
+							// TODO: (enumerable) foreach
+							for (vint i = 0; i < typeLoaders.Count(); i++)
+							{
+								typeLoaders[i]->Unload(this);
+							}
+							typeDescriptors.Clear();
+						});
+						typeVersion++;
 						return true;
 					}
 					else
@@ -192,7 +806,7 @@ description::TypeManager
 					return typeVersion;
 				}
 			};
-			vint TypeManager::typeVersion = -1;
+			atomic_vint TypeManager::typeVersion = -1;
 
 /***********************************************************************
 description::TypeManager helper functions
@@ -246,6 +860,113 @@ description::TypeManager helper functions
 				return nullptr;
 			}
 
+/***********************************************************************
+PreloadRegisteredTypes
+***********************************************************************/
+
+			class TypePreloader : public Object
+			{
+			public:
+				using Clock = std::chrono::steady_clock;
+
+				TypePreloadingStatistics&		statistics;
+				atomic_vint						nextType = 0;
+				atomic_vint						runningWorkers = 0;
+				EventObject						finishedEvent;
+				SpinLock						errorLock;
+				std::exception_ptr				error;
+
+				TypePreloader(TypePreloadingStatistics& _statistics)
+					:statistics(_statistics)
+				{
+					finishedEvent.CreateManualUnsignal(false);
+				}
+
+				static vuint64_t GetMicroseconds(Clock::time_point begin, Clock::time_point end)
+				{
+					return (vuint64_t)std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+				}
+
+				void LoadTypes()
+				{
+					try
+					{
+						while (true)
+						{
+							vint index = nextType++;
+							if (index >= statistics.types.Count()) break;
+
+							auto& timing = statistics.types[index];
+							auto begin = Clock::now();
+							// lazily loaded type descriptors load themselves and their base types before exposing attributes
+							timing.type->GetAttributeCount();
+							timing.microseconds = GetMicroseconds(begin, Clock::now());
+						}
+					}
+					catch (...)
+					{
+						SPIN_LOCK(errorLock)
+						{
+							if (!error) error = std::current_exception();
+						}
+						// stop other workers from picking more types
+						nextType = statistics.types.Count();
+					}
+
+					if (--runningWorkers == 0)
+					{
+						finishedEvent.Signal();
+					}
+				}
+			};
+
+			void PreloadRegisteredTypes(vint workerCount, TypePreloadingStatistics& statistics)
+			{
+#define ERROR_MESSAGE_PREFIX L"vl::reflection::description::PreloadRegisteredTypes(vint, TypePreloadingStatistics&)#"
+				CHECK_ERROR(workerCount > 0, ERROR_MESSAGE_PREFIX L"workerCount must be positive.");
+				auto tm = GetGlobalTypeManager();
+				CHECK_ERROR(tm && tm->IsLoaded(), ERROR_MESSAGE_PREFIX L"The global type manager must be loaded.");
+
+				auto begin = TypePreloader::Clock::now();
+				vint count = tm->GetTypeDescriptorCount();
+				statistics.totalMicroseconds = 0;
+				statistics.types.Resize(count);
+				for (vint i = 0; i < count; i++)
+				{
+					statistics.types[i] = { tm->GetTypeDescriptor(i), 0 };
+				}
+
+				if (workerCount > count)
+				{
+					workerCount = count;
+				}
+
+				// workers share the preloader, since the last one still touches finishedEvent after waking up this thread
+				auto preloader = Ptr(new TypePreloader(statistics));
+				if (workerCount > 0)
+				{
+					preloader->runningWorkers = workerCount;
+					for (vint i = 0; i < workerCount; i++)
+					{
+						if (!ThreadPoolLite::Queue(Func<void()>([preloader]() { preloader->LoadTypes(); })))
+						{
+							// load remaining types in the current thread if the thread pool is stopping
+							preloader->runningWorkers -= workerCount - i - 1;
+							preloader->LoadTypes();
+							break;
+						}
+					}
+					preloader->finishedEvent.Wait();
+				}
+
+				statistics.totalMicroseconds = TypePreloader::GetMicroseconds(begin, TypePreloader::Clock::now());
+				if (preloader->error)
+				{
+					std::rethrow_exception(preloader->error);
+				}
+#undef ERROR_MESSAGE_PREFIX
+			}
+
 /***********************************************************************
 Cpp Helper Functions
 ***********************************************************************/
@@ -7,6 +7,7 @@ Licensed under https://github.com/vczh-libraries/License
 #define VCZH_REFLECTION_DESCRIPTABLEINTERFACES
 
 #include "DescriptableValue.h"
+#include <typeinfo>
 
 namespace vl
 {
@@ -23,35 +24,41 @@ namespace vl
 		namespace description
 		{
 /***********************************************************************
-ValueType
+BoxedValuePool
 ***********************************************************************/
 
-			namespace pbt_selector
+			/// <summary>Usage statistics of the pool for <see cref="IValueType::TypedBox`1"/> in the current thread.</summary>
+			struct BoxedValuePoolStatistics
 			{
-				template<PredefinedBoxableType _Value>
-				struct SelectorBase { static constexpr PredefinedBoxableType Value = _Value; };
-
-				template<typename T> struct Selector : SelectorBase<PredefinedBoxableType::PBT_Unknown> {};
-
-				template<> struct Selector<vint8_t> : SelectorBase<PredefinedBoxableType::PBT_S8> {};
-				template<> struct Selector<vint16_t> : SelectorBase<PredefinedBoxableType::PBT_S16> {};
-				template<> struct Selector<vint32_t> : SelectorBase<PredefinedBoxableType::PBT_S32> {};
-				template<> struct Selector<vint64_t> : SelectorBase<PredefinedBoxableType::PBT_S64> {};
+				/// <summary>Number of allocations.</summary>
+				vuint64_t						allocations = 0;
+				/// <summary>Number of allocations that reuse a block from the pool.</summary>
+				vuint64_t						hits = 0;
+				/// <summary>Number of deallocations.</summary>
+				vuint64_t						deallocations = 0;
+				/// <summary>Number of deallocations that return a block to the pool.</summary>
+				vuint64_t						recycles = 0;
+			};
 
-				template<> struct Selector<vuint8_t> : SelectorBase<PredefinedBoxableType::PBT_U8> {};
-				template<> struct Selector<vuint16_t> : SelectorBase<PredefinedBoxableType::PBT_U16> {};
-				template<> struct Selector<vuint32_t> : SelectorBase<PredefinedBoxableType::PBT_U32> {};
-				template<> struct Selector<vuint64_t> : SelectorBase<PredefinedBoxableType::PBT_U64> {};
+			extern void*						AllocateBoxedValue(size_t size);
+			extern void							DeallocateBoxedValue(void* memory, size_t size);
 
-				template<> struct Selector<float> : SelectorBase<PredefinedBoxableType::PBT_F32> {};
-				template<> struct Selector<double> : SelectorBase<PredefinedBoxableType::PBT_F64> {};
+			/// <summary>Get usage statistics of the pool for <see cref="IValueType::TypedBox`1"/> in the current thread.</summary>
+			/// <returns>The usage statistics.</returns>
+			/// <remarks>The pool is disabled when <b>VCZH_REFLECTION_NO_BOXED_VALUE_POOL</b> is defined, all counters stay 0.</remarks>
+			extern BoxedValuePoolStatistics		GetBoxedValuePoolStatistics();
+			/// <summary>Reset usage statistics of the pool for <see cref="IValueType::TypedBox`1"/> in the current thread.</summary>
+			extern void							ResetBoxedValuePoolStatistics();
+			/// <summary>Free blocks cached by the pool for <see cref="IValueType::TypedBox`1"/> in all threads.</summary>
+			/// <remarks>
+			/// It is called by <see cref="FinalizeGlobalStorage"/>, after that released blocks are no longer cached,
+			/// so that they are not reported as memory leaks.
+			/// </remarks>
+			extern void							DrainBoxedValuePools();
 
-				template<> struct Selector<bool> : SelectorBase<PredefinedBoxableType::PBT_BOOL> {};
-				template<> struct Selector<wchar_t> : SelectorBase<PredefinedBoxableType::PBT_WCHAR> {};
-				template<> struct Selector<WString> : SelectorBase<PredefinedBoxableType::PBT_STRING> {};
-				template<> struct Selector<Locale> : SelectorBase<PredefinedBoxableType::PBT_LOCALE> {};
-				template<> struct Selector<DateTime> : SelectorBase<PredefinedBoxableType::PBT_DATETIME> {};
-			}
+/***********************************************************************
+ValueType
+***********************************************************************/
 
 			class IValueType : public virtual IDescriptable, public Description<IValueType>
 			{
@@ -72,19 +79,84 @@ ValueType
 					{
 					}
 
+#ifndef VCZH_REFLECTION_NO_BOXED_VALUE_POOL
+#ifdef VCZH_CHECK_MEMORY_LEAKS_NEW
+#undef new
+#endif
+					static void* operator new(size_t size)
+					{
+						if constexpr (alignof(TypedBox<T>) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+						{
+							return ::operator new(size, std::align_val_t(alignof(TypedBox<T>)));
+						}
+						else
+						{
+							return AllocateBoxedValue(size);
+						}
+					}
+
+					static void operator delete(void* memory, size_t size)
+					{
+						if constexpr (alignof(TypedBox<T>) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+						{
+							::operator delete(memory, std::align_val_t(alignof(TypedBox<T>)));
+						}
+						else
+						{
+							DeallocateBoxedValue(memory, size);
+						}
+					}
+
+#ifdef VCZH_CHECK_MEMORY_LEAKS_NEW
+					// new expressions are redirected to the debug version of operator new when checking memory leaks
+					static void* operator new(size_t size, int, const char*, int)
+					{
+						return operator new(size);
+					}
+
+					static void operator delete(void* memory, int, const char*, int)
+					{
+						operator delete(memory, sizeof(TypedBox<T>));
+					}
+#define new VCZH_CHECK_MEMORY_LEAKS_NEW
+#endif
+#endif
+
 					PredefinedBoxableType GetBoxableType()override
 					{
 						return pbt_selector::Selector<T>::Value;
 					}
 
+					static const void* GetTag()
+					{
+						static const char tag = 0;
+						return &tag;
+					}
+
+					const void* GetBoxTag()override
+					{
+						return GetTag();
+					}
+
+					static TypedBox<T>* From(IBoxedValue* boxedValue)
+					{
+						if (!boxedValue) return nullptr;
+						if (boxedValue->GetBoxTag() == GetTag())
+						{
+							return static_cast<TypedBox<T>*>(boxedValue);
+						}
+						// the tag could be different when TypedBox<T> is instantiated in another module
+						return dynamic_cast<TypedBox<T>*>(boxedValue);
+					}
+
 					Ptr<IBoxedValue> Copy()override
 					{
 						return Ptr(new TypedBox<T>(value));
 					}
 
-					CompareResult ComparePrimitive(Ptr<IBoxedValue> boxedValue)override
+					CompareResult ComparePrimitive(IBoxedValue* boxedValue)override
 					{
-						if (auto typedBox = boxedValue.Cast<TypedBox<T>>())
+						if (auto typedBox = From(boxedValue))
 						{
 							auto r = value <=> typedBox->value;
 							if constexpr (std::is_same_v<decltype(r), std::partial_ordering>)
@@ -97,6 +169,31 @@ ValueType
 						}
 						return IBoxedValue::NotComparable;
 					}
+
+					vuint64_t GetHashCode()override
+					{
+						if constexpr (std::is_same_v<T, WString>)
+						{
+							return value_hash::HashString(value);
+						}
+						else if constexpr (std::is_same_v<T, Locale>)
+						{
+							return value_hash::HashString(value.GetName());
+						}
+						else if constexpr (std::is_same_v<T, DateTime>)
+						{
+							return value_hash::Mix(value.osInternal);
+						}
+						else if constexpr (std::is_enum_v<T>)
+						{
+							return value_hash::Mix((vuint64_t)value);
+						}
+						else
+						{
+							// structs are compared by their own operator<=>, there is no general way to hash them
+							return 0;
+						}
+					}
 				};
 
 				virtual Value						CreateDefault() = 0;
@@ -277,6 +374,37 @@ ITypeDescriptor (property)
 				virtual IEventInfo*				GetValueChangedEvent()=0;
 				virtual Value					GetValue(const Value& thisObject)=0;
 				virtual void					SetValue(Value& thisObject, const Value& newValue)=0;
+				// skip type checking, only call them when thisObject and newValue are already verified
+				// the default implementation calls GetValue and SetValue
+				virtual Value					GetValueUnchecked(const Value& thisObject);
+				virtual void					SetValueUnchecked(Value& thisObject, const Value& newValue);
+
+				// assign a native function to *invoker (a Func<signature>) and return true if the signature matches exactly
+				// the default implementation returns false
+				virtual bool					QueryNativeGetter(const std::type_info& signature, void* invoker);
+				virtual bool					QueryNativeSetter(const std::type_info& signature, void* invoker);
+
+				/// <summary>Get a native function for reading the property, bypassing boxing.</summary>
+				/// <returns>The native function, or an empty function if the signature does not match exactly.</returns>
+				/// <typeparam name="TSignature">The expected signature, which is <b>TValue(TClass*)</b> for a field, or the signature of the getter with the object as the first argument.</typeparam>
+				template<typename TSignature>
+				Func<TSignature>				GetNativeGetter()
+				{
+					Func<TSignature> invoker;
+					QueryNativeGetter(typeid(TSignature), &invoker);
+					return invoker;
+				}
+
+				/// <summary>Get a native function for writing the property, bypassing boxing.</summary>
+				/// <returns>The native function, or an empty function if the signature does not match exactly.</returns>
+				/// <typeparam name="TSignature">The expected signature, which is <b>void(TClass*, const TValue&amp;)</b> for a field, or the signature of the setter with the object as the first argument.</typeparam>
+				template<typename TSignature>
+				Func<TSignature>				GetNativeSetter()
+				{
+					Func<TSignature> invoker;
+					QueryNativeSetter(typeid(TSignature), &invoker);
+					return invoker;
+				}
 			};
 
 /***********************************************************************
@@ -333,6 +461,32 @@ ITypeDescriptor (method)
 				virtual bool					IsStatic()=0;
 				virtual void					CheckArguments(collections::Array<Value>& arguments)=0;
 				virtual Value					Invoke(const Value& thisObject, collections::Array<Value>& arguments)=0;
+				// the following functions copy arguments to an array and call the above functions by default
+				virtual void					CheckArgumentsInPlace(ValueSpan arguments);
+				virtual Value					InvokeInPlace(const Value& thisObject, ValueSpan arguments);
+				// return -1 if arguments do not match, otherwise return the conversion cost, lower is better
+				// the default implementation returns 0 if CheckArguments does not throw TypeDescriptorException
+				virtual vint					TryCheckArguments(ValueSpan arguments);
+				// skip type checking, only call it when thisObject and arguments are already verified
+				// the default implementation calls InvokeInPlace
+				virtual Value					InvokeUnchecked(const Value& thisObject, ValueSpan arguments);
+				// assign a native function to *invoker (a Func<signature>) and return true if the signature matches exactly
+				// the default implementation returns false
+				virtual bool					QueryNativeInvoker(const std::type_info& signature, void* invoker);
+
+				/// <summary>Get a native function for calling the method, bypassing boxing.</summary>
+				/// <returns>The native function, or an empty function if the signature does not match exactly.</returns>
+				/// <typeparam name="TSignature">
+				/// The expected signature.
+				/// It is <b>R(TClass*, TArgs...)</b> for a method or an external method, and <b>R(TArgs...)</b> for a static method or a constructor.
+				/// </typeparam>
+				template<typename TSignature>
+				Func<TSignature>				GetNativeInvoker()
+				{
+					Func<TSignature> invoker;
+					QueryNativeInvoker(typeid(TSignature), &invoker);
+					return invoker;
+				}
 				virtual Value					CreateFunctionProxy(const Value& thisObject) = 0;
 			};
 
@@ -471,8 +625,27 @@ ITypeManager
 				/// And it is no guarantee that an index will always return the same type for each execution of the same process.
 				/// </remarks>
 				virtual ITypeDescriptor*		GetTypeDescriptor(vint index)=0;
+				/// <summary>Get a registered type by name.</summary>
+				/// <returns>The registered type, or null if it does not exist.</returns>
+				/// <param name="name">The registered name.</param>
+				/// <remarks>
+				/// After <see cref="Load"/> is called, names are looked up in an immutable hash index without locking.
+				/// The index is rebuilt and republished when types are registered or unregistered,
+				/// lookups from other threads see the previous index until then.
+				/// </remarks>
 				virtual ITypeDescriptor*		GetTypeDescriptor(const WString& name)=0;
 				virtual bool					SetTypeDescriptor(const WString& name, Ptr<ITypeDescriptor> typeDescriptor)=0;
+				/// <summary>Register multiple types at once, each one by its own name.</summary>
+				/// <returns>The number of registered types.</returns>
+				/// <param name="typeDescriptors">Types to register.</param>
+				/// <remarks>
+				/// The result is the same as calling <see cref="SetTypeDescriptor"/> for each type in order,
+				/// null types and types whose names are already registered are skipped,
+				/// but all types are sorted and merged at once, and the type version only increases once.
+				/// Prefer this function in <see cref="ITypeLoader::Load"/> when registering a large number of types.
+				/// The default implementation calls <see cref="SetTypeDescriptor"/> for each type.
+				/// </remarks>
+				virtual vint					SetTypeDescriptors(const collections::List<Ptr<ITypeDescriptor>>& typeDescriptors);
 
 				/// <summary>Delay register some types.</summary>
 				/// <returns>Returns true if this operation succeeded.</returns>
@@ -532,6 +705,7 @@ ITypeManager
 			/// it is the name what is used to registere this type.</param>
 			/// <remarks>
 			/// Returning null means the type registration is declared but the type manager has not started.
+			/// If the type manager has been created but not loaded, it is loaded.
 			/// </remarks>
 			extern ITypeDescriptor*				GetTypeDescriptor(const WString& name);
 			extern bool							IsInterfaceType(ITypeDescriptor* typeDescriptor, bool& acceptProxy);
@@ -545,6 +719,35 @@ ITypeManager
 			/// </remarks>
 			extern void							CollectRegisteredTypes(collections::List<ITypeDescriptor*>& types);
 
+			/// <summary>Time spent on loading a type descriptor in <see cref="PreloadRegisteredTypes"/>.</summary>
+			struct TypePreloadingTiming
+			{
+				/// <summary>The loaded type descriptor.</summary>
+				ITypeDescriptor*				type = nullptr;
+				/// <summary>Time in microseconds, including time spent on base types that are loaded or being loaded by other workers.</summary>
+				vuint64_t						microseconds = 0;
+			};
+
+			/// <summary>Timings reported by <see cref="PreloadRegisteredTypes"/>.</summary>
+			struct TypePreloadingStatistics
+			{
+				/// <summary>Time in microseconds from the first type being queued to the last type being loaded.</summary>
+				vuint64_t										totalMicroseconds = 0;
+				/// <summary>Timings for all registered types, in the order of <see cref="ITypeManager::GetTypeDescriptor"/>.</summary>
+				collections::Array<TypePreloadingTiming>		types;
+			};
+
+			/// <summary>Load members of all registered type descriptors from a loaded global type manager, instead of loading them on first access.</summary>
+			/// <param name="workerCount">The number of tasks queued to <see cref="ThreadPoolLite"/> to load types in parallel. It must be positive.</param>
+			/// <param name="statistics">The output timings. Existing items are removed before loading.</param>
+			/// <remarks>
+			/// Loading a type always loads its base types first, base types being loaded by other workers are waited.
+			/// The global type manager must already be loaded.
+			/// Do not register or reset types until this function returns.
+			/// If any type fails to load, the first error is rethrown after all workers finish.
+			/// </remarks>
+			extern void							PreloadRegisteredTypes(vint workerCount, TypePreloadingStatistics& statistics);
+
 			/// <summary>Generate a binary metadata layer.</summary>
 			/// <param name="excludedTypes">
 			/// Registered descriptors supplied by previously loaded layers.
@@ -689,6 +892,126 @@ Exceptions
 				}
 			};
 
+/***********************************************************************
+ValueCallSite and ValueConstructorSite
+***********************************************************************/
+
+			/// <summary>
+			/// A reusable call site for accessing a member by name.
+			/// It remembers resolved members for recently seen types of the receiver,
+			/// so that repeated calls skip looking up the name and selecting overloads.
+			/// </summary>
+			/// <remarks>
+			/// <p>Resolved members are forgotten when <see cref="ITypeManager::GetTypeVersion"/> changes.</p>
+			/// <p>A call site is not thread safe, each thread should use its own call site.</p>
+			/// </remarks>
+			class ValueCallSite : public Object
+			{
+			public:
+				static const vint				PolymorphicCount = 4;
+
+			protected:
+				struct Entry
+				{
+					ITypeDescriptor*			type = nullptr;
+					IPropertyInfo*				propertyInfo = nullptr;
+					IMethodGroupInfo*			methodGroup = nullptr;
+					IMethodInfo*				methodInfo = nullptr;
+					IEventInfo*					eventInfo = nullptr;
+				};
+
+				WString							name;
+				vint							argumentCount;
+				vint							typeVersion = -1;
+				Entry							monomorphic;
+				Entry							polymorphic[PolymorphicCount];
+				vint							nextPolymorphic = 0;
+
+				Entry&							GetEntry(ITypeDescriptor* type);
+				Entry&							GetEntry(const Value& thisObject);
+			public:
+				/// <summary>Create a call site.</summary>
+				/// <param name="_name">The name of the member.</param>
+				/// <param name="_argumentCount">The expected number of arguments when calling a method, which is used to select an overload in advance.</param>
+				ValueCallSite(const WString& _name, vint _argumentCount = 0);
+				~ValueCallSite();
+
+				/// <summary>Get the name of the member.</summary>
+				/// <returns>The name of the member.</returns>
+				const WString&					GetName();
+				/// <summary>Get the expected number of arguments.</summary>
+				/// <returns>The expected number of arguments.</returns>
+				vint							GetArgumentCount();
+
+				/// <summary>Call the getter function for a property, the same as <see cref="Value::GetProperty"/>.</summary>
+				/// <returns>The value of the property.</returns>
+				/// <param name="thisObject">The object to access.</param>
+				Value							GetProperty(const Value& thisObject);
+				/// <summary>Call the setter function for a property, the same as <see cref="Value::SetProperty"/>.</summary>
+				/// <param name="thisObject">The object to access.</param>
+				/// <param name="newValue">The value to set.</param>
+				void							SetProperty(Value& thisObject, const Value& newValue);
+				/// <summary>Call a non-static method, the same as <see cref="Value::Invoke"/>.</summary>
+				/// <returns>The return value from that method.</returns>
+				/// <param name="thisObject">The object to access.</param>
+				/// <param name="arguments">Arguments for the method.</param>
+				Value							Invoke(const Value& thisObject, ValueSpan arguments);
+				/// <summary>Attach a callback function for the event, the same as <see cref="Value::AttachEvent"/>.</summary>
+				/// <returns>The event handler for this attachment.</returns>
+				/// <param name="thisObject">The object to access.</param>
+				/// <param name="function">The callback function.</param>
+				Ptr<IEventHandler>				AttachEvent(const Value& thisObject, const Value& function);
+				/// <summary>Detach a callback function from the event, the same as <see cref="Value::DetachEvent"/>.</summary>
+				/// <returns>Returns true if this operation succeeded.</returns>
+				/// <param name="thisObject">The object to access.</param>
+				/// <param name="handler">The event handler returned from <see cref="AttachEvent"/>.</param>
+				bool							DetachEvent(const Value& thisObject, Ptr<IEventHandler> handler);
+			};
+
+			/// <summary>
+			/// A reusable site for creating objects of a type by name.
+			/// It remembers the type and the constructor for the expected number of arguments,
+			/// so that repeated creation skips looking up the type and selecting overloads.
+			/// </summary>
+			/// <remarks>
+			/// <p>The resolved type and constructor are forgotten when <see cref="ITypeManager::GetTypeVersion"/> changes.</p>
+			/// <p>A constructor site is not thread safe, each thread should use its own constructor site.</p>
+			/// <p>Objects are allocated by <see cref="ConstructorAllocator`1"/>, which could be specialized for a type to use a custom allocator or object pool.</p>
+			/// </remarks>
+			class ValueConstructorSite : public Object
+			{
+			protected:
+				WString							typeName;
+				vint							argumentCount;
+				vint							typeVersion = -1;
+				ITypeDescriptor*				type = nullptr;
+				IMethodGroupInfo*				constructorGroup = nullptr;
+				IMethodInfo*					constructor = nullptr;
+
+				void							Prepare();
+			public:
+				/// <summary>Create a constructor site.</summary>
+				/// <param name="_typeName">The name of the type.</param>
+				/// <param name="_argumentCount">The expected number of arguments, which is used to select a constructor in advance.</param>
+				ValueConstructorSite(const WString& _typeName, vint _argumentCount = 0);
+				~ValueConstructorSite();
+
+				/// <summary>Get the name of the type.</summary>
+				/// <returns>The name of the type.</returns>
+				const WString&					GetTypeName();
+				/// <summary>Get the expected number of arguments.</summary>
+				/// <returns>The expected number of arguments.</returns>
+				vint							GetArgumentCount();
+				/// <summary>Get the type to create.</summary>
+				/// <returns>The type to create.</returns>
+				ITypeDescriptor*				GetTypeDescriptor();
+
+				/// <summary>Create an object, the same as <see cref="Value::Create"/>.</summary>
+				/// <returns>The created object.</returns>
+				/// <param name="arguments">Arguments for the constructor.</param>
+				Value							Create(ValueSpan arguments);
+			};
+
 #endif
 		}
 	}
@@ -754,6 +754,9 @@ ITypeDescriptor
 				ISerializableType*				serializableType = nullptr;
 				List<Ptr<IMethodGroupInfo>>		methodGroups;
 				Ptr<IMethodGroupInfo>			constructorGroup;
+				SpinLock						ancestorsLock;
+				std::atomic<bool>				ancestorsCollected = false;
+				SortedList<ITypeDescriptor*>	ancestors;
 
 			public:
 				MetaonlyTypeDescriptor(MetaonlyReaderContext* _context, Ptr<TypeDescriptorMetadata> _metadata)
@@ -895,15 +898,32 @@ ITypeDescriptor
 					return context->tds[metadata->baseTypeDescriptors[index]].Obj();
 				}
 
+				void CollectAncestors(ITypeDescriptor* typeDescriptor)
+				{
+					if (ancestors.Contains(typeDescriptor)) return;
+					ancestors.Add(typeDescriptor);
+					vint count = typeDescriptor->GetBaseTypeDescriptorCount();
+					for (vint i = 0; i < count; i++)
+					{
+						CollectAncestors(typeDescriptor->GetBaseTypeDescriptor(i));
+					}
+				}
+
 				bool CanConvertTo(ITypeDescriptor* targetType) override
 				{
 					if (this == targetType) return true;
-					vint count = GetBaseTypeDescriptorCount();
-					for (vint i = 0; i < count; i++)
+					if (!ancestorsCollected.load(std::memory_order_acquire))
 					{
-						if (GetBaseTypeDescriptor(i)->CanConvertTo(targetType)) return true;
+						SPIN_LOCK(ancestorsLock)
+						{
+							if (!ancestorsCollected.load(std::memory_order_relaxed))
+							{
+								CollectAncestors(this);
+								ancestorsCollected.store(true, std::memory_order_release);
+							}
+						}
 					}
-					return false;
+					return ancestors.Contains(targetType);
 				}
 
 				vint GetPropertyCount() override
@@ -1424,12 +1444,13 @@ LoadMetaonlyTypes
 
 				void Load(ITypeManager* manager) override
 				{
+					List<Ptr<ITypeDescriptor>> tds;
 					// TODO: (enumerable) foreach
 					for (vint i = context->firstLocalTypeDescriptor; i < context->tds.Count(); i++)
 					{
-						auto td = context->tds[i];
-						manager->SetTypeDescriptor(td->GetTypeName(), td);
+						tds.Add(context->tds[i]);
 					}
+					manager->SetTypeDescriptors(tds);
 				}
 
 				void Unload(ITypeManager* manager) override
@@ -13,18 +13,30 @@ namespace vl
 	namespace reflection
 	{
 
+		namespace description
+		{
+
+/***********************************************************************
+description::IBoxedValue
+***********************************************************************/
+
+			const void* IBoxedValue::GetBoxTag()
+			{
+				return nullptr;
+			}
+
+			vuint64_t IBoxedValue::GetHashCode()
+			{
+				return 0;
+			}
+
 /***********************************************************************
 description::Value
 ***********************************************************************/
 
-		namespace description
-		{
 			Value::Value(DescriptableObject* value)
-				:valueType(value ? RawPtr :Null)
-				,rawPtr(nullptr)
-#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
-				,typeDescriptor(nullptr)
-#endif
+				:rawPtr(nullptr)
+				,valueType(value ? RawPtr :Null)
 			{
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
 				if (value)
@@ -37,63 +49,160 @@ description::Value
 			}
 
 			Value::Value(Ptr<DescriptableObject> value)
-				:valueType(value ? SharedPtr : Null)
-				,rawPtr(nullptr)
-#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
-				,typeDescriptor(nullptr)
-#endif
+				:rawPtr(nullptr)
+				,valueType(value ? SharedPtr : Null)
 			{
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
 				if (value)
 				{
 					rawPtr = value->SafeGetAggregationRoot();
-					sharedPtr = Ptr(rawPtr);
 				}
 #else
 				rawPtr = value.Obj();
-				sharedPtr = value;
 #endif
+				IncreaseReference();
 			}
 
 			Value::Value(Ptr<IBoxedValue> value, ITypeDescriptor* associatedTypeDescriptor)
-				:valueType(value ? BoxedValue : Null)
-				, rawPtr(nullptr)
-				, boxedValue(value)
+				:boxedValue(value.Obj())
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
-				, typeDescriptor(associatedTypeDescriptor)
+				,typeDescriptor(associatedTypeDescriptor)
 #endif
+				,valueType(value ? BoxedValue : Null)
 			{
+				if (value)
+				{
+					// keep primitive values inline, no matter how they are created
+					auto pbt = value->GetBoxableType();
+					switch (pbt)
+					{
+#define DEFINE_INLINE_BOXED_VALUE(PBT, TYPE)\
+					case PredefinedBoxableType::PBT:\
+						if (auto typedBox = value.Cast<IValueType::TypedBox<TYPE>>())\
+						{\
+							inlineType = (vint32_t)pbt;\
+							inlineValue = 0;\
+							memcpy(&inlineValue, &typedBox->value, sizeof(TYPE));\
+						}\
+						break;\
+
+						PBT_INLINE_TYPES(DEFINE_INLINE_BOXED_VALUE)
+#undef DEFINE_INLINE_BOXED_VALUE
+					default:;
+					}
+				}
+				IncreaseReference();
 			}
 
-			Value::Value()
-				:valueType(Null)
-				,rawPtr(0)
+			Value::Value(PredefinedBoxableType pbt, vuint64_t value, ITypeDescriptor* associatedTypeDescriptor)
+				:inlineValue(value)
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
-				,typeDescriptor(nullptr)
+				,typeDescriptor(associatedTypeDescriptor)
 #endif
+				,valueType(BoxedValue)
+				,inlineType((vint32_t)pbt)
+			{
+			}
+
+			DescriptableObject* Value::GetReferencedObject()const
+			{
+				switch (valueType)
+				{
+				case SharedPtr:
+					return rawPtr;
+				case BoxedValue:
+					return inlineType == (vint32_t)PredefinedBoxableType::PBT_Unknown ? boxedValue : nullptr;
+				default:
+					return nullptr;
+				}
+			}
+
+			void Value::IncreaseReference()
+			{
+				if (auto object = GetReferencedObject())
+				{
+					INCRC(ReferenceCounterOperator<DescriptableObject>::CreateCounter(object));
+				}
+			}
+
+			void Value::DecreaseReference()
+			{
+				if (auto object = GetReferencedObject())
+				{
+					auto counter = ReferenceCounterOperator<DescriptableObject>::CreateCounter(object);
+					if (DECRC(counter) == 0)
+					{
+						ReferenceCounterOperator<DescriptableObject>::DeleteReference(counter, object);
+					}
+				}
+			}
+
+			Value::Value()
+				:inlineValue(0)
 			{
 			}
 
 			Value::Value(const Value& value)
-				:valueType(value.valueType)
-				,rawPtr(value.rawPtr)
-				,sharedPtr(value.sharedPtr)
-				,boxedValue(value.boxedValue ? value.boxedValue->Copy() : nullptr)
+				:inlineValue(value.inlineValue)
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+				,typeDescriptor(value.typeDescriptor)
+#endif
+				,valueType(value.valueType)
+				,inlineType(value.inlineType)
+			{
+				IncreaseReference();
+			}
+
+			Value::Value(Value&& value)
+				:inlineValue(value.inlineValue)
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
 				,typeDescriptor(value.typeDescriptor)
 #endif
+				,valueType(value.valueType)
+				,inlineType(value.inlineType)
+			{
+				value.rawPtr = nullptr;
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+				value.typeDescriptor = nullptr;
+#endif
+				value.valueType = Null;
+				value.inlineType = (vint32_t)PredefinedBoxableType::PBT_Unknown;
+			}
+
+			Value::~Value()
 			{
+				DecreaseReference();
 			}
 
 			Value& Value::operator=(const Value& value)
 			{
-				valueType = value.valueType;
-				rawPtr = value.rawPtr;
-				sharedPtr = value.sharedPtr;
-				boxedValue = value.boxedValue ? value.boxedValue->Copy() : nullptr;
+				if (this != &value)
+				{
+					Value copied(value);
+					*this = std::move(copied);
+				}
+				return *this;
+			}
+
+			Value& Value::operator=(Value&& value)
+			{
+				if (this != &value)
+				{
+					DecreaseReference();
+					inlineValue = value.inlineValue;
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+					typeDescriptor = value.typeDescriptor;
+#endif
+					valueType = value.valueType;
+					inlineType = value.inlineType;
+
+					value.rawPtr = nullptr;
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
-				typeDescriptor = value.typeDescriptor;
+					value.typeDescriptor = nullptr;
 #endif
+					value.valueType = Null;
+					value.inlineType = (vint32_t)PredefinedBoxableType::PBT_Unknown;
+				}
 				return *this;
 			}
 
@@ -104,19 +213,99 @@ description::Value
 
 			DescriptableObject* Value::GetRawPtr()const
 			{
-				return rawPtr;
+				return valueType == RawPtr || valueType == SharedPtr ? rawPtr : nullptr;
 			}
 
 			Ptr<DescriptableObject> Value::GetSharedPtr()const
 			{
-				return sharedPtr;
+				return valueType == SharedPtr ? Ptr(rawPtr) : nullptr;
 			}
 
 			Ptr<IBoxedValue> Value::GetBoxedValue()const
 			{
+				if (valueType != BoxedValue) return nullptr;
+				switch ((PredefinedBoxableType)inlineType)
+				{
+#define DEFINE_INLINE_BOXED_VALUE(PBT, TYPE)\
+				case PredefinedBoxableType::PBT:\
+					return Ptr(new IValueType::TypedBox<TYPE>(GetInlineValue<TYPE>()));\
+
+					PBT_INLINE_TYPES(DEFINE_INLINE_BOXED_VALUE)
+#undef DEFINE_INLINE_BOXED_VALUE
+				default:
+					return Ptr(boxedValue);
+				}
+			}
+
+			IBoxedValue* Value::GetBoxedValueRawPtr()const
+			{
+				if (valueType != BoxedValue || inlineType != (vint32_t)PredefinedBoxableType::PBT_Unknown) return nullptr;
 				return boxedValue;
 			}
 
+			Ptr<IBoxedValue> Value::GetMutableBoxedValue()
+			{
+				if (valueType != BoxedValue || inlineType != (vint32_t)PredefinedBoxableType::PBT_Unknown) return nullptr;
+
+				// copies of this value share the same boxed value, copy it before modifying if it is not exclusively owned
+				auto counter = ReferenceCounterOperator<IBoxedValue>::CreateCounter(boxedValue);
+				if (*counter > 1)
+				{
+					auto copied = boxedValue->Copy();
+					DecreaseReference();
+					boxedValue = copied.Obj();
+					IncreaseReference();
+				}
+				return Ptr(boxedValue);
+			}
+
+			PredefinedBoxableType Value::GetInlineBoxableType()const
+			{
+				return (PredefinedBoxableType)inlineType;
+			}
+
+			vuint64_t Value::GetHashCode()const
+			{
+				switch (valueType)
+				{
+				case RawPtr:
+				case SharedPtr:
+					return value_hash::Mix((vuint64_t)(size_t)rawPtr);
+				case BoxedValue:
+					switch ((PredefinedBoxableType)inlineType)
+					{
+#define DEFINE_INLINE_HASH_CODE(PBT, TYPE)\
+					case PredefinedBoxableType::PBT:\
+						{\
+							double number = (double)GetInlineValue<TYPE>();\
+							if (number == 0) number = 0;\
+							vuint64_t bits = 0;\
+							memcpy(&bits, &number, sizeof(number));\
+							return value_hash::Mix(bits);\
+						}\
+
+						DEFINE_INLINE_HASH_CODE(PBT_S8, vint8_t)
+						DEFINE_INLINE_HASH_CODE(PBT_S16, vint16_t)
+						DEFINE_INLINE_HASH_CODE(PBT_S32, vint32_t)
+						DEFINE_INLINE_HASH_CODE(PBT_S64, vint64_t)
+						DEFINE_INLINE_HASH_CODE(PBT_U8, vuint8_t)
+						DEFINE_INLINE_HASH_CODE(PBT_U16, vuint16_t)
+						DEFINE_INLINE_HASH_CODE(PBT_U32, vuint32_t)
+						DEFINE_INLINE_HASH_CODE(PBT_U64, vuint64_t)
+						DEFINE_INLINE_HASH_CODE(PBT_F32, float)
+						DEFINE_INLINE_HASH_CODE(PBT_F64, double)
+#undef DEFINE_INLINE_HASH_CODE
+					case PredefinedBoxableType::PBT_BOOL:
+					case PredefinedBoxableType::PBT_WCHAR:
+						return value_hash::Mix(inlineValue);
+					default:
+						return boxedValue->GetHashCode();
+					}
+				default:
+					return 0;
+				}
+			}
+
 			bool Value::IsNull()const
 			{
 				return valueType == Null;
@@ -226,72 +415,153 @@ description::Value
 
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
 
+			namespace select_method_cache
+			{
+				constexpr vint MaxArgumentCount = 8;
+				constexpr vint EntryCount = 64;
+
+				struct Entry
+				{
+					IMethodGroupInfo*		methodGroup = nullptr;
+					vint					typeVersion = -1;
+					vint					argumentCount = 0;
+					ITypeDescriptor*		types[MaxArgumentCount] = {};
+					Value::ValueType		valueTypes[MaxArgumentCount] = {};
+					IMethodInfo*			method = nullptr;
+				};
+
+				// each thread owns about 8KB of entries, a miss only costs searching the method group again
+				thread_local Entry entries[EntryCount];
+
+				Entry& GetEntry(IMethodGroupInfo* methodGroup, ValueSpan arguments)
+				{
+					auto hash = value_hash::Mix((vuint64_t)(size_t)methodGroup);
+					for (vint i = 0; i < arguments.Count(); i++)
+					{
+						hash = value_hash::Mix(hash ^ (vuint64_t)(size_t)arguments[i].GetTypeDescriptor());
+						hash = value_hash::Mix(hash ^ (vuint64_t)arguments[i].GetValueType());
+					}
+					return entries[hash % EntryCount];
+				}
+
+				bool Match(Entry& entry, IMethodGroupInfo* methodGroup, vint typeVersion, ValueSpan arguments)
+				{
+					if (entry.methodGroup != methodGroup) return false;
+					if (entry.typeVersion != typeVersion) return false;
+					if (entry.argumentCount != arguments.Count()) return false;
+					for (vint i = 0; i < arguments.Count(); i++)
+					{
+						if (entry.types[i] != arguments[i].GetTypeDescriptor()) return false;
+						if (entry.valueTypes[i] != arguments[i].GetValueType()) return false;
+					}
+					return true;
+				}
+
+				void Update(Entry& entry, IMethodGroupInfo* methodGroup, vint typeVersion, ValueSpan arguments, IMethodInfo* method)
+				{
+					entry.methodGroup = methodGroup;
+					entry.typeVersion = typeVersion;
+					entry.argumentCount = arguments.Count();
+					for (vint i = 0; i < arguments.Count(); i++)
+					{
+						entry.types[i] = arguments[i].GetTypeDescriptor();
+						entry.valueTypes[i] = arguments[i].GetValueType();
+					}
+					entry.method = method;
+				}
+			}
+
 			IMethodInfo* Value::SelectMethod(IMethodGroupInfo* methodGroup, collections::Array<Value>& arguments)
+			{
+				return SelectMethod(methodGroup, ValueSpan(arguments));
+			}
+
+			IMethodInfo* Value::SelectMethod(IMethodGroupInfo* methodGroup, ValueSpan arguments)
 			{
 				if(methodGroup->GetMethodCount()==1)
 				{
 					return methodGroup->GetMethod(0);
 				}
 
-				List<IMethodInfo*> methods;
+				// the winning overload only depends on types of arguments, cache it when there are not too many arguments
+				bool cacheable = arguments.Count() <= select_method_cache::MaxArgumentCount;
+				vint typeVersion = cacheable ? GetGlobalTypeManager()->GetTypeVersion() : -1;
+				select_method_cache::Entry* entry = nullptr;
+				if (cacheable)
+				{
+					entry = &select_method_cache::GetEntry(methodGroup, arguments);
+					if (select_method_cache::Match(*entry, methodGroup, typeVersion, arguments))
+					{
+						return entry->method;
+					}
+				}
+
+				IMethodInfo* firstMethod = nullptr;
+				IMethodInfo* bestMethod = nullptr;
+				vint bestCost = -1;
 				for(vint i=0;i<methodGroup->GetMethodCount();i++)
 				{
 					IMethodInfo* method=methodGroup->GetMethod(i);
 					if(method->GetParameterCount()==arguments.Count())
 					{
-						methods.Add(method);
+						if (!firstMethod) firstMethod = method;
+						vint cost = method->TryCheckArguments(arguments);
+						if (cost != -1 && (bestCost == -1 || cost < bestCost))
+						{
+							bestMethod = method;
+							bestCost = cost;
+							if (cost == 0) break;
+						}
 					}
 				}
 
-				if(methods.Count()==0)
+				if(!firstMethod)
 				{
 					throw ArgumentCountMismtatchException(methodGroup);
 				}
-				else if(methods.Count()==1)
+				else if(!bestMethod)
 				{
-					return methods[0];
+					// let Invoke report the mismatched argument
+					return firstMethod;
 				}
-				else
+
+				if (cacheable)
 				{
-					// TODO: (enumerable) foreach
-					for(vint i=0;i<methods.Count();i++)
-					{
-						IMethodInfo* method=methods[i];
-						try
-						{
-							method->CheckArguments(arguments);
-							return method;
-						}
-						catch(const TypeDescriptorException&)
-						{
-						}
-					}
-					return methods[0];
+					select_method_cache::Update(*entry, methodGroup, typeVersion, arguments, bestMethod);
 				}
+				return bestMethod;
 			}
 
 			Value Value::Create(ITypeDescriptor* type)
 			{
-				Array<Value> arguments;
-				return Create(type, arguments);
+				return Create(type, ValueSpan());
 			}
 
 			Value Value::Create(ITypeDescriptor* type, collections::Array<Value>& arguments)
+			{
+				return Create(type, ValueSpan(arguments));
+			}
+
+			Value Value::Create(ITypeDescriptor* type, ValueSpan arguments)
 			{
 				IMethodGroupInfo* methodGroup=type->GetConstructorGroup();
 				if(!methodGroup) throw ConstructorNotExistsException(type);
 
 				IMethodInfo* method=SelectMethod(methodGroup, arguments);
-				return method->Invoke(Value(), arguments);
+				return method->InvokeInPlace(Value(), arguments);
 			}
 
 			Value Value::Create(const WString& typeName)
 			{
-				Array<Value> arguments;
-				return Create(typeName, arguments);
+				return Create(typeName, ValueSpan());
 			}
 
 			Value Value::Create(const WString& typeName, collections::Array<Value>& arguments)
+			{
+				return Create(typeName, ValueSpan(arguments));
+			}
+
+			Value Value::Create(const WString& typeName, ValueSpan arguments)
 			{
 				ITypeDescriptor* type = vl::reflection::description::GetTypeDescriptor(typeName);
 				if(!type) throw TypeNotExistsException(typeName);
@@ -300,11 +570,15 @@ description::Value
 
 			Value Value::InvokeStatic(const WString& typeName, const WString& name)
 			{
-				Array<Value> arguments;
-				return InvokeStatic(typeName, name, arguments);
+				return InvokeStatic(typeName, name, ValueSpan());
 			}
 
 			Value Value::InvokeStatic(const WString& typeName, const WString& name, collections::Array<Value>& arguments)
+			{
+				return InvokeStatic(typeName, name, ValueSpan(arguments));
+			}
+
+			Value Value::InvokeStatic(const WString& typeName, const WString& name, ValueSpan arguments)
 			{
 				ITypeDescriptor* type=vl::reflection::description::GetTypeDescriptor(typeName);
 				if(!type) throw TypeNotExistsException(typeName);
@@ -313,7 +587,7 @@ description::Value
 				if(!methodGroup) throw MemberNotExistsException(name, type);
 
 				IMethodInfo* method=SelectMethod(methodGroup, arguments);
-				return method->Invoke(Value(), arguments);
+				return method->InvokeInPlace(Value(), arguments);
 			}
 
 			Value Value::GetProperty(const WString& name)const
@@ -340,11 +614,15 @@ description::Value
 
 			Value Value::Invoke(const WString& name)const
 			{
-				Array<Value> arguments;
-				return Invoke(name, arguments);
+				return Invoke(name, ValueSpan());
 			}
 
 			Value Value::Invoke(const WString& name, collections::Array<Value>& arguments)const
+			{
+				return Invoke(name, ValueSpan(arguments));
+			}
+
+			Value Value::Invoke(const WString& name, ValueSpan arguments)const
 			{
 				ITypeDescriptor* type=GetTypeDescriptor();
 				if(!type) throw ArgumentNullException(L"thisObject", name);
@@ -353,7 +631,7 @@ description::Value
 				if(!methodGroup) throw MemberNotExistsException(name, type);
 
 				IMethodInfo* method=SelectMethod(methodGroup, arguments);
-				return method->Invoke(*this, arguments);
+				return method->InvokeInPlace(*this, arguments);
 			}
 
 			Ptr<IEventHandler> Value::AttachEvent(const WString& name, const Value& function)const
@@ -379,6 +657,221 @@ description::Value
 				return eventInfo->Detach(*this, handler);
 			}
 
+/***********************************************************************
+ValueCallSite
+***********************************************************************/
+
+			ValueCallSite::Entry& ValueCallSite::GetEntry(ITypeDescriptor* type)
+			{
+				if (monomorphic.type == type)
+				{
+					return monomorphic;
+				}
+				for (vint i = 0; i < PolymorphicCount; i++)
+				{
+					if (polymorphic[i].type == type)
+					{
+						return polymorphic[i];
+					}
+				}
+
+				Entry* entry = nullptr;
+				if (!monomorphic.type)
+				{
+					entry = &monomorphic;
+				}
+				else
+				{
+					entry = &polymorphic[nextPolymorphic];
+					nextPolymorphic = (nextPolymorphic + 1) % PolymorphicCount;
+				}
+				*entry = {};
+				entry->type = type;
+				return *entry;
+			}
+
+			ValueCallSite::Entry& ValueCallSite::GetEntry(const Value& thisObject)
+			{
+				ITypeDescriptor* type = thisObject.GetTypeDescriptor();
+				if (!type) throw ArgumentNullException(L"thisObject", name);
+
+				vint currentTypeVersion = GetGlobalTypeManager()->GetTypeVersion();
+				if (typeVersion != currentTypeVersion)
+				{
+					typeVersion = currentTypeVersion;
+					monomorphic = {};
+					for (vint i = 0; i < PolymorphicCount; i++)
+					{
+						polymorphic[i] = {};
+					}
+					nextPolymorphic = 0;
+				}
+				return GetEntry(type);
+			}
+
+			ValueCallSite::ValueCallSite(const WString& _name, vint _argumentCount)
+				:name(_name)
+				, argumentCount(_argumentCount)
+			{
+			}
+
+			ValueCallSite::~ValueCallSite()
+			{
+			}
+
+			const WString& ValueCallSite::GetName()
+			{
+				return name;
+			}
+
+			vint ValueCallSite::GetArgumentCount()
+			{
+				return argumentCount;
+			}
+
+			Value ValueCallSite::GetProperty(const Value& thisObject)
+			{
+				auto& entry = GetEntry(thisObject);
+				if (!entry.propertyInfo)
+				{
+					entry.propertyInfo = entry.type->GetPropertyByName(name, true);
+					if (!entry.propertyInfo) throw MemberNotExistsException(name, entry.type);
+				}
+				return entry.propertyInfo->GetValue(thisObject);
+			}
+
+			void ValueCallSite::SetProperty(Value& thisObject, const Value& newValue)
+			{
+				auto& entry = GetEntry(thisObject);
+				if (!entry.propertyInfo)
+				{
+					entry.propertyInfo = entry.type->GetPropertyByName(name, true);
+					if (!entry.propertyInfo) throw MemberNotExistsException(name, entry.type);
+				}
+				entry.propertyInfo->SetValue(thisObject, newValue);
+			}
+
+			Value ValueCallSite::Invoke(const Value& thisObject, ValueSpan arguments)
+			{
+				auto& entry = GetEntry(thisObject);
+				if (!entry.methodGroup)
+				{
+					entry.methodGroup = entry.type->GetMethodGroupByName(name, true);
+					if (!entry.methodGroup) throw MemberNotExistsException(name, entry.type);
+
+					// an overload is remembered only when it is the only one accepting argumentCount arguments
+					for (vint i = 0; i < entry.methodGroup->GetMethodCount(); i++)
+					{
+						auto method = entry.methodGroup->GetMethod(i);
+						if (method->GetParameterCount() == argumentCount)
+						{
+							if (entry.methodInfo)
+							{
+								entry.methodInfo = nullptr;
+								break;
+							}
+							entry.methodInfo = method;
+						}
+					}
+				}
+
+				IMethodInfo* method = entry.methodInfo && arguments.Count() == argumentCount
+					? entry.methodInfo
+					: Value::SelectMethod(entry.methodGroup, arguments);
+				return method->InvokeInPlace(thisObject, arguments);
+			}
+
+			Ptr<IEventHandler> ValueCallSite::AttachEvent(const Value& thisObject, const Value& function)
+			{
+				auto& entry = GetEntry(thisObject);
+				if (!entry.eventInfo)
+				{
+					entry.eventInfo = entry.type->GetEventByName(name, true);
+					if (!entry.eventInfo) throw MemberNotExistsException(name, entry.type);
+				}
+
+				Ptr<IValueFunctionProxy> proxy = UnboxValue<Ptr<IValueFunctionProxy>>(function, description::GetTypeDescriptor<IValueFunctionProxy>(), WString::Unmanaged(L"function"));
+				return entry.eventInfo->Attach(thisObject, proxy);
+			}
+
+			bool ValueCallSite::DetachEvent(const Value& thisObject, Ptr<IEventHandler> handler)
+			{
+				auto& entry = GetEntry(thisObject);
+				if (!entry.eventInfo)
+				{
+					entry.eventInfo = entry.type->GetEventByName(name, true);
+					if (!entry.eventInfo) throw MemberNotExistsException(name, entry.type);
+				}
+				return entry.eventInfo->Detach(thisObject, handler);
+			}
+
+/***********************************************************************
+ValueConstructorSite
+***********************************************************************/
+
+			void ValueConstructorSite::Prepare()
+			{
+				vint currentTypeVersion = GetGlobalTypeManager()->GetTypeVersion();
+				if (typeVersion == currentTypeVersion) return;
+
+				type = vl::reflection::description::GetTypeDescriptor(typeName);
+				if (!type) throw TypeNotExistsException(typeName);
+				constructorGroup = type->GetConstructorGroup();
+				if (!constructorGroup) throw ConstructorNotExistsException(type);
+
+				// a constructor is remembered only when it is the only one accepting argumentCount arguments
+				constructor = nullptr;
+				for (vint i = 0; i < constructorGroup->GetMethodCount(); i++)
+				{
+					auto method = constructorGroup->GetMethod(i);
+					if (method->GetParameterCount() == argumentCount)
+					{
+						if (constructor)
+						{
+							constructor = nullptr;
+							break;
+						}
+						constructor = method;
+					}
+				}
+				typeVersion = currentTypeVersion;
+			}
+
+			ValueConstructorSite::ValueConstructorSite(const WString& _typeName, vint _argumentCount)
+				:typeName(_typeName)
+				, argumentCount(_argumentCount)
+			{
+			}
+
+			ValueConstructorSite::~ValueConstructorSite()
+			{
+			}
+
+			const WString& ValueConstructorSite::GetTypeName()
+			{
+				return typeName;
+			}
+
+			vint ValueConstructorSite::GetArgumentCount()
+			{
+				return argumentCount;
+			}
+
+			ITypeDescriptor* ValueConstructorSite::GetTypeDescriptor()
+			{
+				Prepare();
+				return type;
+			}
+
+			Value ValueConstructorSite::Create(ValueSpan arguments)
+			{
+				Prepare();
+				IMethodInfo* method = constructor && arguments.Count() == argumentCount
+					? constructor
+					: Value::SelectMethod(constructorGroup, arguments);
+				return method->InvokeInPlace(Value(), arguments);
+			}
+
 #endif
 
 			bool Value::DeleteRawPtr()
@@ -21,6 +21,7 @@ namespace vl
 			class IEventInfo;
 			class IEventHandler;
 			class IValueFunctionProxy;
+			class ValueSpan;
 		}
 
 		namespace description
@@ -42,6 +43,86 @@ Value
 				PBT_DATETIME,
 			};
 
+			namespace pbt_selector
+			{
+				template<PredefinedBoxableType _Value>
+				struct SelectorBase { static constexpr PredefinedBoxableType Value = _Value; };
+
+				template<typename T> struct Selector : SelectorBase<PredefinedBoxableType::PBT_Unknown> {};
+
+				template<> struct Selector<vint8_t> : SelectorBase<PredefinedBoxableType::PBT_S8> {};
+				template<> struct Selector<vint16_t> : SelectorBase<PredefinedBoxableType::PBT_S16> {};
+				template<> struct Selector<vint32_t> : SelectorBase<PredefinedBoxableType::PBT_S32> {};
+				template<> struct Selector<vint64_t> : SelectorBase<PredefinedBoxableType::PBT_S64> {};
+
+				template<> struct Selector<vuint8_t> : SelectorBase<PredefinedBoxableType::PBT_U8> {};
+				template<> struct Selector<vuint16_t> : SelectorBase<PredefinedBoxableType::PBT_U16> {};
+				template<> struct Selector<vuint32_t> : SelectorBase<PredefinedBoxableType::PBT_U32> {};
+				template<> struct Selector<vuint64_t> : SelectorBase<PredefinedBoxableType::PBT_U64> {};
+
+				template<> struct Selector<float> : SelectorBase<PredefinedBoxableType::PBT_F32> {};
+				template<> struct Selector<double> : SelectorBase<PredefinedBoxableType::PBT_F64> {};
+
+				template<> struct Selector<bool> : SelectorBase<PredefinedBoxableType::PBT_BOOL> {};
+				template<> struct Selector<wchar_t> : SelectorBase<PredefinedBoxableType::PBT_WCHAR> {};
+				template<> struct Selector<WString> : SelectorBase<PredefinedBoxableType::PBT_STRING> {};
+				template<> struct Selector<Locale> : SelectorBase<PredefinedBoxableType::PBT_LOCALE> {};
+				template<> struct Selector<DateTime> : SelectorBase<PredefinedBoxableType::PBT_DATETIME> {};
+
+#define PBT_INLINE_TYPES(F)\
+				F(PBT_S8, vint8_t)\
+				F(PBT_S16, vint16_t)\
+				F(PBT_S32, vint32_t)\
+				F(PBT_S64, vint64_t)\
+				F(PBT_U8, vuint8_t)\
+				F(PBT_U16, vuint16_t)\
+				F(PBT_U32, vuint32_t)\
+				F(PBT_U64, vuint64_t)\
+				F(PBT_F32, float)\
+				F(PBT_F64, double)\
+				F(PBT_BOOL, bool)\
+				F(PBT_WCHAR, wchar_t)\
+
+				// PBT_S8 to PBT_WCHAR are small enough to be stored in Value without an IBoxedValue
+				constexpr bool IsInline(PredefinedBoxableType pbt)
+				{
+					return PredefinedBoxableType::PBT_S8 <= pbt && pbt <= PredefinedBoxableType::PBT_WCHAR;
+				}
+
+				template<typename T>
+				constexpr bool IsInlineType = IsInline(Selector<T>::Value);
+			}
+
+			namespace value_hash
+			{
+				inline vuint64_t Mix(vuint64_t value)
+				{
+					value ^= value >> 33;
+					value *= 0xFF51AFD7ED558CCDULL;
+					value ^= value >> 33;
+					value *= 0xC4CEB9FE1A85EC53ULL;
+					value ^= value >> 33;
+					return value;
+				}
+
+				template<typename T>
+				vuint64_t HashBuffer(const T* buffer, vint length)
+				{
+					vuint64_t hash = 0xCBF29CE484222325ULL;
+					for (vint i = 0; i < length; i++)
+					{
+						hash ^= (vuint64_t)buffer[i];
+						hash *= 0x100000001B3ULL;
+					}
+					return hash;
+				}
+
+				inline vuint64_t HashString(const WString& value)
+				{
+					return HashBuffer(value.Buffer(), value.Length());
+				}
+			}
+
 			class IBoxedValue : public virtual IDescriptable, public Description<IBoxedValue>
 			{
 			public:
@@ -54,8 +135,14 @@ Value
 				};
 
 				virtual PredefinedBoxableType	GetBoxableType() = 0;
+				/// <summary>Get a tag that identifies the type of the boxed value without dynamic_cast.</summary>
+				/// <returns>The tag. The default implementation returns null, which never matches any <see cref="IValueType::TypedBox`1"/>.</returns>
+				virtual const void*				GetBoxTag();
 				virtual Ptr<IBoxedValue>		Copy() = 0;
-				virtual CompareResult			ComparePrimitive(Ptr<IBoxedValue> boxedValue) = 0;
+				virtual CompareResult			ComparePrimitive(IBoxedValue* boxedValue) = 0;
+				/// <summary>Get the hash code of the value, values that compare equal must have the same hash code.</summary>
+				/// <returns>The hash code. The default implementation returns 0, which is correct but makes all values of this type collide.</returns>
+				virtual vuint64_t				GetHashCode();
 			};
 
 			/// <summary>A type to store all values of reflectable types.</summary>
@@ -67,8 +154,11 @@ Value
 			///     <li>[F:vl.reflection.description.BoxParameter`1]</li>
 			///     <li>[F:vl.reflection.description.UnboxParameter`1]</li>
 			/// </ul>
+			/// Copies of a boxed value share the same <see cref="IBoxedValue"/>.
+			/// Code that modifies a boxed value in place must get it by <see cref="GetMutableBoxedValue"/>, which copies it first if it is shared,
+			/// otherwise all copies are modified.
 			/// </remarks>
-			class Value : public Object
+			class Value
 			{
 			public:
 				/// <summary>How the value is stored.</summary>
@@ -84,22 +174,40 @@ Value
 					BoxedValue,
 				};
 			protected:
-				ValueType						valueType;
-				DescriptableObject*				rawPtr;
-				Ptr<DescriptableObject>			sharedPtr;
-				Ptr<IBoxedValue>				boxedValue;
+				// only one of them is used according to valueType and inlineType
+				// a shared pointer or a boxed value holds a reference to the object by its intrusive reference counter
+				union
+				{
+					DescriptableObject*			rawPtr;
+					IBoxedValue*				boxedValue;
+					vuint64_t					inlineValue;
+				};
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
-				ITypeDescriptor*				typeDescriptor;
+				ITypeDescriptor*				typeDescriptor = nullptr;
 #endif
+				ValueType						valueType = Null;
+				vint32_t						inlineType = (vint32_t)PredefinedBoxableType::PBT_Unknown;
 
 				Value(DescriptableObject* value);
 				Value(Ptr<DescriptableObject> value);
 				Value(Ptr<IBoxedValue> value, ITypeDescriptor* associatedTypeDescriptor);
+				Value(PredefinedBoxableType pbt, vuint64_t value, ITypeDescriptor* associatedTypeDescriptor);
+
+				DescriptableObject*				GetReferencedObject()const;
+				void							IncreaseReference();
+				void							DecreaseReference();
 			public:
 				/// <summary>Create a null value.</summary>
 				Value();
+				/// <summary>Copy a value. A boxed value is shared until one of them is modified by <see cref="GetMutableBoxedValue"/>.</summary>
+				/// <param name="value">The value to copy.</param>
 				Value(const Value& value);
+				/// <summary>Move a value. The moved value becomes null.</summary>
+				/// <param name="value">The value to move.</param>
+				Value(Value&& value);
+				~Value();
 				Value&							operator=(const Value& value);
+				Value&							operator=(Value&& value);
 
 				friend std::partial_ordering	operator<=>(const Value& a, const Value& b);
 				friend bool						operator==(const Value& a, const Value& b) { return (a <=> b) == 0; }
@@ -115,7 +223,39 @@ Value
 				Ptr<DescriptableObject>			GetSharedPtr()const;
 				/// <summary>Get the stored value if <b>GetValueType()</b> returns <b>BoxedValue</b>.</summary>
 				/// <returns>The stored text. Returns empty if failed.</returns>
+				/// <remarks>
+				/// <p>For a primitive value that is stored inline, a new boxed value is allocated every time. Call <see cref="GetInlineBoxableType"/> and <see cref="GetInlineValue`1"/> to read it without allocation.</p>
+				/// <p>The boxed value could be shared by copies of this value, it must not be modified. Call <see cref="GetMutableBoxedValue"/> instead.</p>
+				/// </remarks>
 				Ptr<IBoxedValue>				GetBoxedValue()const;
+				/// <summary>Get the stored value without touching its reference counter if <b>GetValueType()</b> returns <b>BoxedValue</b>.</summary>
+				/// <returns>The stored value. Returns null if failed, or if the value is a primitive value stored inline.</returns>
+				/// <remarks>The boxed value could be shared by copies of this value, it must not be modified.</remarks>
+				IBoxedValue*					GetBoxedValueRawPtr()const;
+				/// <summary>Get the stored value for modification if <b>GetValueType()</b> returns <b>BoxedValue</b>.</summary>
+				/// <returns>The stored value, which is copied first if it is shared by other values. Returns empty if failed, or if the value is a primitive value stored inline.</returns>
+				Ptr<IBoxedValue>				GetMutableBoxedValue();
+				/// <summary>Get the type of the primitive value if it is stored inline without boxing.</summary>
+				/// <returns>The type of the primitive value. Returns <b>PBT_Unknown</b> if the value is not stored inline.</returns>
+				PredefinedBoxableType			GetInlineBoxableType()const;
+				/// <summary>Get the primitive value that is stored inline.</summary>
+				/// <returns>The stored primitive value.</returns>
+				/// <typeparam name="T">Type of the primitive value, it must match <b>GetInlineBoxableType()</b>.</typeparam>
+				template<typename T>
+					requires(pbt_selector::IsInlineType<T>)
+				T GetInlineValue()const
+				{
+					T value;
+					memcpy(&value, &inlineValue, sizeof(T));
+					return value;
+				}
+				/// <summary>Get a hash code that is consistent with <b>operator==</b>.</summary>
+				/// <returns>The hash code.</returns>
+				/// <remarks>
+				/// <p>Numbers from <b>vint8_t</b> to <b>double</b> are hashed by their value in <b>double</b>, so that equal numbers of different types have the same hash code.</p>
+				/// <p>All values of a struct type have the same hash code.</p>
+				/// </remarks>
+				vuint64_t						GetHashCode()const;
 				/// <summary>Test if this value isnull.</summary>
 				/// <returns>Returns true if this value is null.</returns>
 				bool							IsNull()const;
@@ -144,9 +284,23 @@ Value
 				/// <param name="value">The boxed value to store.</param>
 				/// <param name="type">The type of the boxed value.</param>
 				static Value					From(Ptr<IBoxedValue> value, ITypeDescriptor* type);
+				/// <summary>Create a primitive value that is stored inline without boxing.</summary>
+				/// <returns>The created value.</returns>
+				/// <typeparam name="T">Type of the primitive value, from <b>vint8_t</b> to <b>wchar_t</b> in <see cref="PredefinedBoxableType"/>.</typeparam>
+				/// <param name="value">The primitive value to store.</param>
+				/// <param name="type">The type of the primitive value.</param>
+				template<typename T>
+					requires(pbt_selector::IsInlineType<T>)
+				static Value From(T value, ITypeDescriptor* type)
+				{
+					vuint64_t bits = 0;
+					memcpy(&bits, &value, sizeof(T));
+					return Value(pbt_selector::Selector<T>::Value, bits, type);
+				}
 
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
 				static IMethodInfo*				SelectMethod(IMethodGroupInfo* methodGroup, collections::Array<Value>& arguments);
+				static IMethodInfo*				SelectMethod(IMethodGroupInfo* methodGroup, ValueSpan arguments);
 
 				/// <summary>Call the default constructor of the specified type to create a value.</summary>
 				/// <returns>The created value.</returns>
@@ -259,6 +413,11 @@ Value
 				/// }
 				/// ]]></example>
 				static Value					Create(ITypeDescriptor* type, collections::Array<Value>& arguments);
+				/// <summary>Call the constructor of the specified type to create a value, without copying arguments to an array.</summary>
+				/// <returns>The created value.</returns>
+				/// <param name="type">The type to create the value.</param>
+				/// <param name="arguments">Arguments for the constructor.</param>
+				static Value					Create(ITypeDescriptor* type, ValueSpan arguments);
 
 				/// <summary>Call the default constructor of the specified type to create a value.</summary>
 				/// <returns>The created value.</returns>
@@ -371,6 +530,11 @@ Value
 				/// }
 				/// ]]></example>
 				static Value					Create(const WString& typeName, collections::Array<Value>& arguments);
+				/// <summary>Call the constructor of the specified type to create a value, without copying arguments to an array.</summary>
+				/// <returns>The created value.</returns>
+				/// <param name="typeName">The registered full name for the type to create the value.</param>
+				/// <param name="arguments">Arguments for the constructor.</param>
+				static Value					Create(const WString& typeName, ValueSpan arguments);
 
 				/// <summary>Call a static method of the specified type.</summary>
 				/// <returns>The return value from that method.</returns>
@@ -470,6 +634,12 @@ Value
 				/// }
 				/// ]]></example>
 				static Value					InvokeStatic(const WString& typeName, const WString& name, collections::Array<Value>& arguments);
+				/// <summary>Call a static method of the specified type, without copying arguments to an array.</summary>
+				/// <returns>The return value from that method.</returns>
+				/// <param name="typeName">The registered full name for the type.</param>
+				/// <param name="name">The registered name for the method.</param>
+				/// <param name="arguments">Arguments for the method.</param>
+				static Value					InvokeStatic(const WString& typeName, const WString& name, ValueSpan arguments);
 
 				/// <summary>Call the getter function for a property.</summary>
 				/// <returns>The value of the property.</returns>
@@ -768,6 +938,18 @@ Value
 				/// }
 				/// ]]></example>
 				Value							Invoke(const WString& name, collections::Array<Value>& arguments)const;
+				/// <summary>Call a non-static method, without copying arguments to an array.</summary>
+				/// <returns>The return value from that method.</returns>
+				/// <param name="name">The registered name for the method.</param>
+				/// <param name="arguments">Arguments for the method.</param>
+				/// <remarks>
+				/// <p>Only available when <b>VCZH_DEBUG_NO_REFLECTION</b> is <b>off</b>.</p>
+				/// </remarks>
+				/// <example><![CDATA[
+				/// Value arguments[] = { BoxValue<vint>(1), BoxValue<vint>(2) };
+				/// auto result = myClass.Invoke(L"Add", arguments);
+				/// ]]></example>
+				Value							Invoke(const WString& name, ValueSpan arguments)const;
 
 				/// <summary>Attach a callback function for the event.</summary>
 				/// <returns>The event handler for this attachment. You need to keep it to detach the callback function.</returns>
@@ -1126,6 +1308,68 @@ Value
 				/// ]]></example>
 				bool							DeleteRawPtr();
 			};
+
+			static_assert(sizeof(Value) <= 24, "Value is expected to be stored in no more than 24 bytes.");
+
+/***********************************************************************
+ValueSpan
+***********************************************************************/
+
+			/// <summary>A non-owning view of contiguous values, used to pass arguments without allocating an array.</summary>
+			/// <remarks>The viewed values must stay alive during the call that receives the span.</remarks>
+			class ValueSpan
+			{
+			protected:
+				Value*							buffer = nullptr;
+				vint							count = 0;
+
+			public:
+				/// <summary>Create an empty span.</summary>
+				ValueSpan() = default;
+
+				/// <summary>Create a span from a buffer.</summary>
+				/// <param name="_buffer">The first value.</param>
+				/// <param name="_count">The number of values.</param>
+				ValueSpan(Value* _buffer, vint _count)
+					:buffer(_buffer)
+					, count(_count)
+				{
+				}
+
+				/// <summary>Create a span viewing all values in an array.</summary>
+				/// <param name="values">The array.</param>
+				ValueSpan(collections::Array<Value>& values)
+					:buffer(values.Count() == 0 ? nullptr : &values[0])
+					, count(values.Count())
+				{
+				}
+
+				/// <summary>Create a span viewing all values in a C++ array.</summary>
+				/// <typeparam name="Size">The number of values.</typeparam>
+				/// <param name="values">The C++ array.</param>
+				template<vint Size>
+				ValueSpan(Value(&values)[Size])
+					:buffer(values)
+					, count(Size)
+				{
+				}
+
+				/// <summary>Get the number of values.</summary>
+				/// <returns>The number of values.</returns>
+				vint Count()const
+				{
+					return count;
+				}
+
+				/// <summary>Get the reference to the specified value.</summary>
+				/// <returns>The reference to the specified value. It will crash when the index is out of range.</returns>
+				/// <param name="index">The index of the value.</param>
+				Value& operator[](vint index)const
+				{
+					CHECK_ERROR(0 <= index && index < count, L"ValueSpan::operator[](vint)#Argument index not in range.");
+					return buffer[index];
+				}
+			};
 		}
 	}
 }
@@ -86,11 +86,26 @@ description::Value
 					using R1 = typename RealUnboxType<PBT1>::Type;
 					using R2 = typename RealUnboxType<PBT2>::Type;
 
-					E1 e1 = (E1)v1.GetBoxedValue().Cast<IValueType::TypedBox<R1>>()->value;
-					E2 e2 = (E2)v2.GetBoxedValue().Cast<IValueType::TypedBox<R2>>()->value;
+					E1 e1 = (E1)v1.GetInlineValue<R1>();
+					E2 e2 = (E2)v2.GetInlineValue<R2>();
 					return Compare(e1, e2);
 				}
 
+				std::partial_ordering PBT_CompareInline(const Value& v1, const Value& v2)
+				{
+					switch (v1.GetInlineBoxableType())
+					{
+#define DEFINE_PBT_COMPARE_INLINE(PBT, TYPE)\
+					case PredefinedBoxableType::PBT:\
+						return v1.GetInlineValue<TYPE>() <=> v2.GetInlineValue<TYPE>();\
+
+						PBT_INLINE_TYPES(DEFINE_PBT_COMPARE_INLINE)
+#undef DEFINE_PBT_COMPARE_INLINE
+					default:
+						return std::partial_ordering::unordered;
+					}
+				}
+
 #undef DEFINE_PBT_COMPARE
 			}
 
@@ -122,9 +137,19 @@ description::Value
 					if (adt == bdt)
 #endif
 					{
-						auto pa = a.GetBoxedValue();
-						auto pb = b.GetBoxedValue();
-						switch (pa->ComparePrimitive(pb))
+						auto apbt = a.GetInlineBoxableType();
+						auto bpbt = b.GetInlineBoxableType();
+						if (apbt != bpbt)
+						{
+							return std::partial_ordering::unordered;
+						}
+						if (apbt != PredefinedBoxableType::PBT_Unknown)
+						{
+							return pbt_selector::PBT_CompareInline(a, b);
+						}
+
+						// compare boxed values in place to avoid copying Ptr<IBoxedValue>
+						switch (a.boxedValue->ComparePrimitive(b.boxedValue))
 						{
 						case IBoxedValue::Smaller: return std::partial_ordering::less;
 						case IBoxedValue::Greater: return std::partial_ordering::greater;
@@ -162,8 +187,8 @@ description::Value
 
 					{
 						static std::partial_ordering(*PBT_CompareMatrix[pbt_selector::PBT_COUNT][pbt_selector::PBT_COUNT])(const Value & v1, const Value & v2) = { DEFINE_PBT_MATRIX };
-						auto apbt = (vint)a.GetBoxedValue()->GetBoxableType();
-						auto bpbt = (vint)b.GetBoxedValue()->GetBoxableType();
+						auto apbt = (vint)a.GetInlineBoxableType();
+						auto bpbt = (vint)b.GetInlineBoxableType();
 						if (pbt_selector::PBT_MIN <= apbt && apbt <= pbt_selector::PBT_MAX)
 						{
 							if (pbt_selector::PBT_MIN <= bpbt && bpbt <= pbt_selector::PBT_MAX)
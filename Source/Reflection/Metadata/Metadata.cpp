@@ -16,6 +16,30 @@ namespace vl
 
 #ifndef VCZH_DEBUG_NO_REFLECTION
 
+/***********************************************************************
+TypeDescriptorSlot
+***********************************************************************/
+
+			ITypeDescriptor* TypeDescriptorSlot::Refresh(ITypeManager* typeManager, const wchar_t* typeName, vint cachedVersion)
+			{
+				// the result is only cached when the version stays unchanged during looking up
+				// an unloaded type manager is loaded by GetTypeDescriptor(const WString&), which changes the version, so the result is not cached
+				auto currentVersion = typeManager->GetTypeVersion();
+				auto result = description::GetTypeDescriptor(WString::Unmanaged(typeName));
+				if (typeManager->GetTypeVersion() != currentVersion)
+				{
+					return result;
+				}
+
+				if (cachedVersion != Writing && typeVersion.compare_exchange_strong(cachedVersion, Writing, std::memory_order_acquire))
+				{
+					std::atomic_thread_fence(std::memory_order_release);
+					typeDescriptor.store(result, std::memory_order_relaxed);
+					typeVersion.store(currentVersion, std::memory_order_release);
+				}
+				return result;
+			}
+
 /***********************************************************************
 TypeDescriptorTypeInfo
 ***********************************************************************/
@@ -306,6 +330,30 @@ TypeDescriptorImplBase
 			{
 			}
 
+			void TypeDescriptorImplBase::LoadOnceInternal(void(*loading)(TypeDescriptorImplBase*))
+			{
+				vint currentThread = Thread::GetCurrentThreadId();
+				if (loadingThread == currentThread) return;
+
+				CriticalSection::Scope scope(loadingLock);
+				if (loaded.load(std::memory_order_relaxed)) return;
+
+				// a type that fails to load is not loaded again, the same as before it became thread safe
+				loadingThread = currentThread;
+				try
+				{
+					loading(this);
+				}
+				catch (...)
+				{
+					loadingThread = -1;
+					loaded.store(true, std::memory_order_release);
+					throw;
+				}
+				loadingThread = -1;
+				loaded.store(true, std::memory_order_release);
+			}
+
 			TypeDescriptorImplBase::TypeDescriptorImplBase(TypeDescriptorFlags _typeDescriptorFlags, const TypeInfoContent* _typeInfoContent)
 				:typeDescriptorFlags(_typeDescriptorFlags)
 				, typeInfoContent(_typeInfoContent)
@@ -365,11 +413,10 @@ ValueTypeDescriptorBase
 
 			void ValueTypeDescriptorBase::Load()
 			{
-				if (!loaded)
+				LoadOnce([](TypeDescriptorImplBase* descriptor)
 				{
-					loaded = true;
-					LoadInternal();
-				}
+					static_cast<ValueTypeDescriptorBase*>(descriptor)->LoadInternal();
+				});
 			}
 
 			void ValueTypeDescriptorBase::LoadForAttributeAccess()
@@ -379,7 +426,6 @@ ValueTypeDescriptorBase
 
 			ValueTypeDescriptorBase::ValueTypeDescriptorBase(TypeDescriptorFlags _typeDescriptorFlags, const TypeInfoContent* _typeInfoContent)
 				:TypeDescriptorImplBase(_typeDescriptorFlags, _typeInfoContent)
-				, loaded(false)
 			{
 			}
 
@@ -535,12 +581,26 @@ MethodInfoImpl
 				,returnInfo(_return)
 				,isStatic(_isStatic)
 			{
+				if (returnInfo)
+				{
+					returnTypeDescriptor = returnInfo->GetTypeDescriptor();
+				}
 			}
 
 			MethodInfoImpl::~MethodInfoImpl()
 			{
 			}
 
+			ITypeDescriptor* const* MethodInfoImpl::GetParameterTypeDescriptors()
+			{
+				return parameterTypeDescriptors.Count() == 0 ? nullptr : &parameterTypeDescriptors[0];
+			}
+
+			ITypeDescriptor* MethodInfoImpl::GetReturnTypeDescriptor()
+			{
+				return returnTypeDescriptor;
+			}
+
 			ITypeDescriptor* MethodInfoImpl::GetOwnerTypeDescriptor()
 			{
 				return ownerMethodGroup->GetOwnerTypeDescriptor();
@@ -590,6 +650,11 @@ MethodInfoImpl
 
 			void MethodInfoImpl::CheckArguments(collections::Array<Value>& arguments)
 			{
+				CheckArgumentsInPlace(arguments);
+			}
+
+			void MethodInfoImpl::CheckArgumentsInPlace(ValueSpan arguments)
+			{
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
 				if(arguments.Count()!=parameters.Count())
 				{
@@ -608,8 +673,51 @@ MethodInfoImpl
 #endif
 			}
 
+			vint MethodInfoImpl::TryCheckArguments(ValueSpan arguments)
+			{
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+				if(arguments.Count()!=parameters.Count())
+				{
+					return -1;
+				}
+
+				// exact type: 0, base type: 1, object: 2
+				auto rootType = GetGlobalTypeManager()->GetRootType();
+				vint cost = 0;
+				for(vint i=0;i<parameters.Count();i++)
+				{
+					auto parameterType = parameters[i]->GetType();
+					if(!arguments[i].CanConvertTo(parameterType))
+					{
+						return -1;
+					}
+
+					if (!arguments[i].IsNull())
+					{
+						auto parameterTd = parameterType->GetTypeDescriptor();
+						if (parameterTd == rootType)
+						{
+							cost += 2;
+						}
+						else if (parameterTd != arguments[i].GetTypeDescriptor())
+						{
+							cost += 1;
+						}
+					}
+				}
+				return cost;
+#else
+				CHECK_FAIL(L"Not Implemented under VCZH_DEBUG_METAONLY_REFLECTION!");
+#endif
+			}
+
 			Value MethodInfoImpl::Invoke(const Value& thisObject, collections::Array<Value>& arguments)
 			{
+				return InvokeInPlace(thisObject, arguments);
+			}
+
+			Value MethodInfoImpl::InvokeInPlace(const Value& thisObject, ValueSpan arguments)
+			{
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
 				if(thisObject.IsNull())
 				{
@@ -622,7 +730,20 @@ MethodInfoImpl
 				{
 					throw ArgumentTypeMismtatchException(L"thisObject", ownerMethodGroup->GetOwnerTypeDescriptor(), Value::RawPtr, thisObject);
 				}
-				CheckArguments(arguments);
+				CheckArgumentsInPlace(arguments);
+				return InvokeInternal(thisObject, arguments);
+#else
+				CHECK_FAIL(L"Not Implemented under VCZH_DEBUG_METAONLY_REFLECTION!");
+#endif
+			}
+
+			Value MethodInfoImpl::InvokeUnchecked(const Value& thisObject, ValueSpan arguments)
+			{
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+#ifdef _DEBUG
+				CHECK_ERROR(thisObject.IsNull() ? isStatic : thisObject.CanConvertTo(ownerMethodGroup->GetOwnerTypeDescriptor(), Value::RawPtr), L"MethodInfoImpl::InvokeUnchecked(const Value&, ValueSpan)#Argument thisObject does not match the method.");
+				CHECK_ERROR(TryCheckArguments(arguments) != -1, L"MethodInfoImpl::InvokeUnchecked(const Value&, ValueSpan)#Arguments do not match the method.");
+#endif
 				return InvokeInternal(thisObject, arguments);
 #else
 				CHECK_FAIL(L"Not Implemented under VCZH_DEBUG_METAONLY_REFLECTION!");
@@ -660,6 +781,7 @@ MethodInfoImpl
 					}
 				}
 				parameters.Add(parameter);
+				parameterTypeDescriptors.Add(parameter->GetType()->GetTypeDescriptor());
 				return true;
 			}
 
@@ -921,8 +1043,7 @@ PropertyInfoImpl
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
 				if(getter)
 				{
-					Array<Value> arguments;
-					return getter->Invoke(thisObject, arguments);
+					return getter->InvokeInPlace(thisObject, ValueSpan());
 				}
 				else
 				{
@@ -938,9 +1059,41 @@ PropertyInfoImpl
 #ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
 				if(setter)
 				{
-					Array<Value> arguments(1);
-					arguments[0]=newValue;
-					setter->Invoke(thisObject, arguments);
+					Value arguments[] = { newValue };
+					setter->InvokeInPlace(thisObject, arguments);
+				}
+				else
+				{
+					throw PropertyIsNotWritableException(this);
+				}
+#else
+				CHECK_FAIL(L"Not Implemented under VCZH_DEBUG_METAONLY_REFLECTION!");
+#endif
+			}
+
+			Value PropertyInfoImpl::GetValueUnchecked(const Value& thisObject)
+			{
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+				if(getter)
+				{
+					return getter->InvokeUnchecked(thisObject, ValueSpan());
+				}
+				else
+				{
+					throw PropertyIsNotReadableException(this);
+				}
+#else
+				CHECK_FAIL(L"Not Implemented under VCZH_DEBUG_METAONLY_REFLECTION!");
+#endif
+			}
+
+			void PropertyInfoImpl::SetValueUnchecked(Value& thisObject, const Value& newValue)
+			{
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+				if(setter)
+				{
+					Value arguments[] = { newValue };
+					setter->InvokeUnchecked(thisObject, arguments);
 				}
 				else
 				{
@@ -951,6 +1104,16 @@ PropertyInfoImpl
 #endif
 			}
 
+			bool PropertyInfoImpl::QueryNativeGetter(const std::type_info& signature, void* invoker)
+			{
+				return getter ? getter->QueryNativeInvoker(signature, invoker) : false;
+			}
+
+			bool PropertyInfoImpl::QueryNativeSetter(const std::type_info& signature, void* invoker)
+			{
+				return setter ? setter->QueryNativeInvoker(signature, invoker) : false;
+			}
+
 /***********************************************************************
 PropertyInfoImpl_StaticCpp
 ***********************************************************************/
@@ -1078,6 +1241,41 @@ FieldInfoImpl
 #endif
 			}
 
+			Value FieldInfoImpl::GetValueUnchecked(const Value& thisObject)
+			{
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+#ifdef _DEBUG
+				CHECK_ERROR(!thisObject.IsNull(), L"FieldInfoImpl::GetValueUnchecked(const Value&)#Argument thisObject should not be null.");
+#endif
+				return GetValueInternal(thisObject);
+#else
+				CHECK_FAIL(L"Not Implemented under VCZH_DEBUG_METAONLY_REFLECTION!");
+#endif
+			}
+
+			void FieldInfoImpl::SetValueUnchecked(Value& thisObject, const Value& newValue)
+			{
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+#ifdef _DEBUG
+				CHECK_ERROR(!thisObject.IsNull(), L"FieldInfoImpl::SetValueUnchecked(Value&, const Value&)#Argument thisObject should not be null.");
+				CHECK_ERROR(newValue.CanConvertTo(returnInfo.Obj()), L"FieldInfoImpl::SetValueUnchecked(Value&, const Value&)#Argument newValue does not match the field.");
+#endif
+				SetValueInternal(thisObject, newValue);
+#else
+				CHECK_FAIL(L"Not Implemented under VCZH_DEBUG_METAONLY_REFLECTION!");
+#endif
+			}
+
+			bool FieldInfoImpl::QueryNativeGetter(const std::type_info& signature, void* invoker)
+			{
+				return false;
+			}
+
+			bool FieldInfoImpl::QueryNativeSetter(const std::type_info& signature, void* invoker)
+			{
+				return false;
+			}
+
 /***********************************************************************
 TypeDescriptorImpl
 ***********************************************************************/
@@ -1108,6 +1306,7 @@ TypeDescriptorImpl
 
 			IPropertyInfo* TypeDescriptorImpl::AddProperty(Ptr<IPropertyInfo> value)
 			{
+				IncreaseMembersVersion();
 				properties.Add(value->GetName(), value);
 				SetLastRegisteredMember(value.Obj());
 				return value.Obj();
@@ -1115,6 +1314,7 @@ TypeDescriptorImpl
 
 			IEventInfo* TypeDescriptorImpl::AddEvent(Ptr<IEventInfo> value)
 			{
+				IncreaseMembersVersion();
 				events.Add(value->GetName(), value);
 				SetLastRegisteredMember(value.Obj());
 				return value.Obj();
@@ -1122,6 +1322,7 @@ TypeDescriptorImpl
 
 			IMethodInfo* TypeDescriptorImpl::AddMethod(const WString& name, Ptr<MethodInfoImpl> value)
 			{
+				IncreaseMembersVersion();
 				MethodGroupInfoImpl* methodGroup=PrepareMethodGroup(name);
 				value->SetOwnerMethodgroup(methodGroup);
 				methodGroup->AddMethod(value);
@@ -1131,6 +1332,7 @@ TypeDescriptorImpl
 
 			IMethodInfo* TypeDescriptorImpl::AddConstructor(Ptr<MethodInfoImpl> value)
 			{
+				IncreaseMembersVersion();
 				MethodGroupInfoImpl* methodGroup=PrepareConstructorGroup();
 				value->SetOwnerMethodgroup(methodGroup);
 				methodGroup->AddMethod(value);
@@ -1140,16 +1342,83 @@ TypeDescriptorImpl
 
 			void TypeDescriptorImpl::AddBaseType(ITypeDescriptor* value)
 			{
+				IncreaseMembersVersion();
 				baseTypeDescriptors.Add(value);
 			}
 
+			atomic_vint TypeDescriptorImpl::typeMembersVersion = 0;
+
+			void TypeDescriptorImpl::IncreaseMembersVersion()
+			{
+				// membersVersion is updated before typeMembersVersion, so a reader seeing a new typeMembersVersion also sees it
+				membersVersion = typeMembersVersion + 1;
+				typeMembersVersion++;
+			}
+
+			void TypeDescriptorImpl::BuildLookupTables(ITypeDescriptor* typeDescriptor, bool inherited)
+			{
+				if (!ancestorTypeDescriptors.Contains(typeDescriptor))
+				{
+					ancestorTypeDescriptors.Add(typeDescriptor);
+					if (auto impl = dynamic_cast<TypeDescriptorImpl*>(typeDescriptor))
+					{
+						ancestorTypeDescriptorImpls.Add(impl);
+					}
+				}
+
+				// members are visited in the same order as searching them recursively, so the first one wins
+				for (vint i = 0; i < typeDescriptor->GetPropertyCount(); i++)
+				{
+					auto info = typeDescriptor->GetProperty(i);
+					propertyTable.TryAdd(info->GetName(), info, inherited);
+				}
+				for (vint i = 0; i < typeDescriptor->GetEventCount(); i++)
+				{
+					auto info = typeDescriptor->GetEvent(i);
+					eventTable.TryAdd(info->GetName(), info, inherited);
+				}
+				for (vint i = 0; i < typeDescriptor->GetMethodGroupCount(); i++)
+				{
+					auto info = typeDescriptor->GetMethodGroup(i);
+					methodGroupTable.TryAdd(info->GetName(), info, inherited);
+				}
+				for (vint i = 0; i < typeDescriptor->GetBaseTypeDescriptorCount(); i++)
+				{
+					BuildLookupTables(typeDescriptor->GetBaseTypeDescriptor(i), true);
+				}
+			}
+
 			void TypeDescriptorImpl::Load()
 			{
-				if(!loaded)
+				LoadOnce([](TypeDescriptorImplBase* descriptor)
 				{
-					loaded=true;
-					LoadInternal();
+					auto td = static_cast<TypeDescriptorImpl*>(descriptor);
+					td->LoadInternal();
+					td->BuildLookupTables(td, false);
+					// base types could be loaded and add members while building, so the version is taken after that
+					td->lookupTablesVersion = typeMembersVersion;
+					td->lookupTablesVerifiedVersion = td->lookupTablesVersion;
+					td->lookupTablesBuilt = true;
+				});
+			}
+
+			bool TypeDescriptorImpl::IsLookupTablesAvailable()
+			{
+				if (!lookupTablesBuilt || lookupTablesOutdated) return false;
+				vint version = typeMembersVersion;
+				if (lookupTablesVerifiedVersion == version) return true;
+
+				// something is added somewhere after the last check, the tables are outdated only if it is added to this type or a base type
+				for (auto impl : ancestorTypeDescriptorImpls)
+				{
+					if (impl->membersVersion > lookupTablesVersion)
+					{
+						lookupTablesOutdated = true;
+						return false;
+					}
 				}
+				lookupTablesVerifiedVersion = version;
+				return true;
 			}
 
 			void TypeDescriptorImpl::LoadForAttributeAccess()
@@ -1159,7 +1428,6 @@ TypeDescriptorImpl
 
 			TypeDescriptorImpl::TypeDescriptorImpl(TypeDescriptorFlags _typeDescriptorFlags, const TypeInfoContent* _typeInfoContent)
 				:TypeDescriptorImplBase(_typeDescriptorFlags, _typeInfoContent)
-				,loaded(false)
 			{
 			}
 
@@ -1210,6 +1478,10 @@ TypeDescriptorImpl
 			{
 				Load();
 				if (this == targetType) return true;
+				if (IsLookupTablesAvailable())
+				{
+					return ancestorTypeDescriptors.Contains(targetType);
+				}
 				// TODO: (enumerable) foreach
 				for (vint i = 0; i < baseTypeDescriptors.Count(); i++)
 				{
@@ -1239,28 +1511,17 @@ TypeDescriptorImpl
 
 			bool TypeDescriptorImpl::IsPropertyExists(const WString& name, bool inheritable)
 			{
-				Load();
-				if(properties.Keys().Contains(name))
-				{
-					return true;
-				}
-				if(inheritable)
-				{
-					// TODO: (enumerable) foreach
-					for(vint i=0;i<baseTypeDescriptors.Count();i++)
-					{
-						if(baseTypeDescriptors[i]->IsPropertyExists(name, true))
-						{
-							return true;
-						}
-					}
-				}
-				return false;
+				return GetPropertyByName(name, inheritable) != nullptr;
 			}
 
 			IPropertyInfo* TypeDescriptorImpl::GetPropertyByName(const WString& name, bool inheritable)
 			{
 				Load();
+				if (IsLookupTablesAvailable())
+				{
+					return propertyTable.Find(name, inheritable);
+				}
+
 				vint index=properties.Keys().IndexOf(name);
 				if(index!=-1)
 				{
@@ -1302,28 +1563,17 @@ TypeDescriptorImpl
 
 			bool TypeDescriptorImpl::IsEventExists(const WString& name, bool inheritable)
 			{
-				Load();
-				if(events.Keys().Contains(name))
-				{
-					return true;
-				}
-				if(inheritable)
-				{
-					// TODO: (enumerable) foreach
-					for(vint i=0;i<baseTypeDescriptors.Count();i++)
-					{
-						if(baseTypeDescriptors[i]->IsEventExists(name, true))
-						{
-							return true;
-						}
-					}
-				}
-				return false;
+				return GetEventByName(name, inheritable) != nullptr;
 			}
 
 			IEventInfo* TypeDescriptorImpl::GetEventByName(const WString& name, bool inheritable)
 			{
 				Load();
+				if (IsLookupTablesAvailable())
+				{
+					return eventTable.Find(name, inheritable);
+				}
+
 				vint index=events.Keys().IndexOf(name);
 				if(index!=-1)
 				{
@@ -1365,28 +1615,17 @@ TypeDescriptorImpl
 
 			bool TypeDescriptorImpl::IsMethodGroupExists(const WString& name, bool inheritable)
 			{
-				Load();
-				if(methodGroups.Keys().Contains(name))
-				{
-					return true;
-				}
-				if(inheritable)
-				{
-					// TODO: (enumerable) foreach
-					for(vint i=0;i<baseTypeDescriptors.Count();i++)
-					{
-						if(baseTypeDescriptors[i]->IsMethodGroupExists(name, true))
-						{
-							return true;
-						}
-					}
-				}
-				return false;
+				return GetMethodGroupByName(name, inheritable) != nullptr;
 			}
 
 			IMethodGroupInfo* TypeDescriptorImpl::GetMethodGroupByName(const WString& name, bool inheritable)
 			{
 				Load();
+				if (IsLookupTablesAvailable())
+				{
+					return methodGroupTable.Find(name, inheritable);
+				}
+
 				vint index=methodGroups.Keys().IndexOf(name);
 				if(index!=-1)
 				{
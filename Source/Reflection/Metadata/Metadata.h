@@ -18,6 +18,10 @@ namespace vl
 			template<typename T>
 			struct TypeInfoRetriver;
 
+#ifdef VCZH_CHECK_MEMORY_LEAKS_NEW
+#undef new
+#endif
+
 			/// <summary>
 			/// A reference holder to an unboxed object.
 			/// </summary>
@@ -26,13 +30,53 @@ namespace vl
 			struct Unboxed
 			{
 			private:
+				// small trivially copyable objects are owned in place instead of on the heap
+				static constexpr bool InlineStorage = std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(vuint64_t);
+
+				union Storage
+				{
+					char		placeholder;
+					T			value;
+
+					Storage() :placeholder(0) {}
+				};
+				struct NoStorage {};
+
 				T*				object;
 				bool			owned;
+				bool			inlined = false;
+				std::conditional_t<InlineStorage, Storage, NoStorage>	storage;
 
 			public:
 				Unboxed(T* _object, bool _owned) : object(_object), owned(_owned) {}
-				Unboxed(Unboxed<T>&& unboxed) : object(unboxed.object), owned(unboxed.owned) { unboxed.object = nullptr; }
-				~Unboxed() { if (object && owned) { delete object; } }
+				Unboxed(T&& _value)
+					: object(nullptr)
+					, owned(true)
+				{
+					if constexpr (InlineStorage)
+					{
+						new(&storage.value) T(std::move(_value));
+						object = &storage.value;
+						inlined = true;
+					}
+					else
+					{
+						object = new T(std::move(_value));
+					}
+				}
+				Unboxed(Unboxed<T>&& unboxed) : object(unboxed.object), owned(unboxed.owned), inlined(unboxed.inlined)
+				{
+					if constexpr (InlineStorage)
+					{
+						if (inlined)
+						{
+							new(&storage.value) T(unboxed.storage.value);
+							object = &storage.value;
+						}
+					}
+					unboxed.object = nullptr;
+				}
+				~Unboxed() { if (object && owned && !inlined) { delete object; } }
 
 				Unboxed() = delete;
 				Unboxed(const Unboxed<T>&&) = delete;
@@ -56,6 +100,10 @@ namespace vl
 				}
 			};
 
+#ifdef VCZH_CHECK_MEMORY_LEAKS_NEW
+#define new VCZH_CHECK_MEMORY_LEAKS_NEW
+#endif
+
 			template<typename T>
 			Value BoxValue(const T& object, ITypeDescriptor* typeDescriptor = nullptr);
 
@@ -96,6 +144,41 @@ TypeInfo
 			template<typename T>
 			struct TypeInfo;
 
+			/// <summary>A lock-free cache of a registered type, refreshed when <see cref="ITypeManager::GetTypeVersion"/> changes.</summary>
+			class TypeDescriptorSlot
+			{
+			protected:
+				// typeVersion works as a sequence lock, readers retry when it changes during reading typeDescriptor
+				// Writing marks a thread updating the slot, other threads look up the type by name without updating
+				// Initial is the version of a type manager that has never changed, null is cached for it, so the type manager is not loaded before any type is registered
+				static constexpr vint					Initial = -1;
+				static constexpr vint					Writing = -3;
+
+				atomic_vint								typeVersion = Initial;
+				std::atomic<ITypeDescriptor*>			typeDescriptor = nullptr;
+
+				ITypeDescriptor*						Refresh(ITypeManager* typeManager, const wchar_t* typeName, vint cachedVersion);
+			public:
+				ITypeDescriptor* Get(const wchar_t* typeName)
+				{
+					if (auto tm = GetGlobalTypeManager())
+					{
+						auto cachedVersion = typeVersion.load(std::memory_order_acquire);
+						if (cachedVersion == tm->GetTypeVersion())
+						{
+							auto cached = typeDescriptor.load(std::memory_order_relaxed);
+							std::atomic_thread_fence(std::memory_order_acquire);
+							if (typeVersion.load(std::memory_order_relaxed) == cachedVersion)
+							{
+								return cached;
+							}
+						}
+						return Refresh(tm, typeName, cachedVersion);
+					}
+					return nullptr;
+				}
+			};
+
 			/// <summary>Get a registered type given a C++ type.</summary>
 			/// <returns>Returns the metadata class for this registered type.</returns>
 			/// <typeparam name="T">The C++ type to get the registered type.</typeparam>
@@ -103,26 +186,14 @@ TypeInfo
 			/// Returning null means the type registration is declared but the type manager has not started.
 			/// Failing to compile means that the type registration is not declared.
 			/// See <see cref="Description`1"/> about how to register a type.
+			/// The type manager is created by <see cref="GetGlobalTypeManager"/> if necessary. A type manager that is unloaded after any change is loaded, the same as looking up a type by name.
+			/// The result is cached, it is safe to call this function in multiple threads.
 			/// </remarks>
 			template<typename T>
 			ITypeDescriptor* GetTypeDescriptor()
 			{
-				static vint typeVersion = -1;
-				static ITypeDescriptor* cached = nullptr;
-				if (auto tm = GetGlobalTypeManager())
-				{
-					auto currentVersion = tm->GetTypeVersion();
-					if (typeVersion != currentVersion)
-					{
-						cached = GetTypeDescriptor(TypeInfo<T>::content.typeName);
-					}
-					return cached;
-				}
-				else
-				{
-					typeVersion = -1;
-					return nullptr;
-				}
+				static TypeDescriptorSlot slot;
+				return slot.Get(TypeInfo<T>::content.typeName);
 			}
 
 #endif
@@ -316,10 +387,26 @@ SerializableTypeDescriptor
 
 				const WString&								GetFullName()override;
 
+				// loaded is published after the type finishes loading, so that a loaded type is read without locking
+				// loadingThread allows members registered in LoadInternal to call Load again on the same thread
+				// loading could take a long time, so other threads loading the same type sleep on loadingLock instead of spinning
+				std::atomic<bool>							loaded = false;
+				atomic_vint									loadingThread = -1;
+				CriticalSection								loadingLock;
+
+				void										LoadOnceInternal(void(*loading)(TypeDescriptorImplBase*));
 			protected:
 				const TypeInfoContent*						GetTypeInfoContentInternal();
 				virtual void								LoadForAttributeAccess();
 
+				void LoadOnce(void(*loading)(TypeDescriptorImplBase*))
+				{
+					if (!loaded.load(std::memory_order_acquire))
+					{
+						LoadOnceInternal(loading);
+					}
+				}
+
 			public:
 				TypeDescriptorImplBase(TypeDescriptorFlags _typeDescriptorFlags, const TypeInfoContent* _typeInfoContent);
 				~TypeDescriptorImplBase();
@@ -334,7 +421,6 @@ SerializableTypeDescriptor
 			class ValueTypeDescriptorBase : public TypeDescriptorImplBase
 			{
 			protected:
-				bool										loaded;
 				Ptr<IValueType>								valueType;
 				Ptr<IEnumType>								enumType;
 				Ptr<ISerializableType>						serializableType;
@@ -413,7 +499,14 @@ MethodInfoImpl
 				Ptr<ITypeInfo>							returnInfo;
 				bool									isStatic;
 
-				virtual Value							InvokeInternal(const Value& thisObject, collections::Array<Value>& arguments)=0;
+				// type descriptors collected during registration, so that invoking does not query ITypeInfo
+				collections::List<ITypeDescriptor*>		parameterTypeDescriptors;
+				ITypeDescriptor*						returnTypeDescriptor = nullptr;
+
+				ITypeDescriptor* const*					GetParameterTypeDescriptors();
+				ITypeDescriptor*						GetReturnTypeDescriptor();
+
+				virtual Value							InvokeInternal(const Value& thisObject, ValueSpan arguments)=0;
 				virtual Value							CreateFunctionProxyInternal(const Value& thisObject) = 0;
 			public:
 				MethodInfoImpl(IMethodGroupInfo* _ownerMethodGroup, Ptr<ITypeInfo> _return, bool _isStatic);
@@ -428,7 +521,11 @@ MethodInfoImpl
 				ITypeInfo*								GetReturn()override;
 				bool									IsStatic()override;
 				void									CheckArguments(collections::Array<Value>& arguments)override;
+				void									CheckArgumentsInPlace(ValueSpan arguments)override;
+				vint									TryCheckArguments(ValueSpan arguments)override;
 				Value									Invoke(const Value& thisObject, collections::Array<Value>& arguments)override;
+				Value									InvokeInPlace(const Value& thisObject, ValueSpan arguments)override;
+				Value									InvokeUnchecked(const Value& thisObject, ValueSpan arguments)override;
 				Value									CreateFunctionProxy(const Value& thisObject)override;
 				bool									AddParameter(Ptr<IParameterInfo> parameter);
 				bool									SetOwnerMethodgroup(IMethodGroupInfo* _ownerMethodGroup);
@@ -520,6 +617,10 @@ TypeDescriptorImpl
 				IEventInfo*								GetValueChangedEvent()override;
 				Value									GetValue(const Value& thisObject)override;
 				void									SetValue(Value& thisObject, const Value& newValue)override;
+				Value									GetValueUnchecked(const Value& thisObject)override;
+				void									SetValueUnchecked(Value& thisObject, const Value& newValue)override;
+				bool									QueryNativeGetter(const std::type_info& signature, void* invoker)override;
+				bool									QueryNativeSetter(const std::type_info& signature, void* invoker)override;
 			};
 
 			class PropertyInfoImpl_StaticCpp : public PropertyInfoImpl, private IPropertyInfo::ICpp
@@ -563,6 +664,83 @@ FieldInfoImpl
 				IEventInfo*								GetValueChangedEvent()override;
 				Value									GetValue(const Value& thisObject)override;
 				void									SetValue(Value& thisObject, const Value& newValue)override;
+				Value									GetValueUnchecked(const Value& thisObject)override;
+				void									SetValueUnchecked(Value& thisObject, const Value& newValue)override;
+				bool									QueryNativeGetter(const std::type_info& signature, void* invoker)override;
+				bool									QueryNativeSetter(const std::type_info& signature, void* invoker)override;
+			};
+
+/***********************************************************************
+MemberNameTable
+***********************************************************************/
+
+			template<typename TInfo>
+			class MemberNameTable
+			{
+			protected:
+				struct Entry
+				{
+					WString								name;
+					vuint64_t							hash;
+					TInfo*								info;
+					bool								inherited;
+				};
+
+				// entries are added but never removed, buckets stores indices to entries with linear probing, -1 means an empty bucket
+				collections::List<Entry>				entries;
+				collections::Array<vint>				buckets;
+
+				vint FindBucket(const WString& name, vuint64_t hash)
+				{
+					vint mask = buckets.Count() - 1;
+					vint bucket = (vint)(hash & (vuint64_t)mask);
+					while (true)
+					{
+						vint index = buckets[bucket];
+						if (index == -1) return bucket;
+						auto& entry = entries[index];
+						if (entry.hash == hash && entry.name == name) return bucket;
+						bucket = (bucket + 1) & mask;
+					}
+				}
+
+				void Rehash(vint bucketCount)
+				{
+					buckets.Resize(bucketCount);
+					for (vint i = 0; i < bucketCount; i++)
+					{
+						buckets[i] = -1;
+					}
+					for (vint i = 0; i < entries.Count(); i++)
+					{
+						buckets[FindBucket(entries[i].name, entries[i].hash)] = i;
+					}
+				}
+			public:
+				/// <summary>Add a member if there is no member of the same name.</summary>
+				/// <returns>Returns true if the member is added.</returns>
+				bool TryAdd(const WString& name, TInfo* info, bool inherited)
+				{
+					vuint64_t hash = value_hash::HashString(name);
+					if ((entries.Count() + 1) * 2 > buckets.Count())
+					{
+						Rehash(buckets.Count() == 0 ? 16 : buckets.Count() * 2);
+					}
+
+					vint bucket = FindBucket(name, hash);
+					if (buckets[bucket] != -1) return false;
+					buckets[bucket] = entries.Add({ name,hash,info,inherited });
+					return true;
+				}
+
+				TInfo* Find(const WString& name, bool inheritable)
+				{
+					if (buckets.Count() == 0) return nullptr;
+					vint index = buckets[FindBucket(name, value_hash::HashString(name))];
+					if (index == -1) return nullptr;
+					auto& entry = entries[index];
+					return inheritable || !entry.inherited ? entry.info : nullptr;
+				}
 			};
 
 /***********************************************************************
@@ -572,13 +750,32 @@ TypeDescriptorImpl
 			class TypeDescriptorImpl : public TypeDescriptorImplBase
 			{
 			private:
-				bool														loaded;
 				collections::List<ITypeDescriptor*>							baseTypeDescriptors;
 				collections::Dictionary<WString, Ptr<IPropertyInfo>>		properties;
 				collections::Dictionary<WString, Ptr<IEventInfo>>			events;
 				collections::Dictionary<WString, Ptr<MethodGroupInfoImpl>>	methodGroups;
 				Ptr<MethodGroupInfoImpl>									constructorGroup;
 
+				// members of this type and all base types, a member shadows members of the same name in base types
+				// they are available after LoadInternal, members registered in LoadInternal could be searched before that
+				// adding a member or a base type increases membersVersion of the type,
+				// lookup tables of this type or any sub type built before that are no longer used, searching falls back to base types recursively
+				static atomic_vint											typeMembersVersion;
+				atomic_vint													membersVersion = 0;
+				bool														lookupTablesBuilt = false;
+				vint														lookupTablesVersion = -1;
+				atomic_vint													lookupTablesVerifiedVersion = -1;
+				std::atomic<bool>											lookupTablesOutdated = false;
+				MemberNameTable<IPropertyInfo>								propertyTable;
+				MemberNameTable<IEventInfo>									eventTable;
+				MemberNameTable<IMethodGroupInfo>							methodGroupTable;
+				collections::SortedList<ITypeDescriptor*>					ancestorTypeDescriptors;
+				collections::List<TypeDescriptorImpl*>						ancestorTypeDescriptorImpls;
+
+				void						BuildLookupTables(ITypeDescriptor* typeDescriptor, bool inherited);
+				bool						IsLookupTablesAvailable();
+				void						IncreaseMembersVersion();
+
 			protected:
 				MethodGroupInfoImpl*		PrepareMethodGroup(const WString& name);
 				MethodGroupInfoImpl*		PrepareConstructorGroup();
@@ -652,7 +849,7 @@ CustomFieldInfoImpl
 						TClass* object = UnboxValue<TClass*>(thisObject);
 						if (object)
 						{
-							auto result = UnboxParameter<TField>(newValue, GetReturn()->GetTypeDescriptor(), L"newValue");
+							auto result = UnboxParameter<TField>(newValue, GetReturn()->GetTypeDescriptor(), WString::Unmanaged(L"newValue"));
 							object->*fieldRef = result.Ref();
 						}
 					}
@@ -673,6 +870,40 @@ CustomFieldInfoImpl
 					return nullptr;
 				}
 
+				bool QueryNativeGetter(const std::type_info& signature, void* invoker)override
+				{
+					if constexpr (std::is_copy_constructible_v<TField>)
+					{
+						if (signature != typeid(TField(TClass*))) return false;
+						*static_cast<Func<TField(TClass*)>*>(invoker) = [fieldRef = fieldRef](TClass* object)->TField
+						{
+							return object->*fieldRef;
+						};
+						return true;
+					}
+					else
+					{
+						return false;
+					}
+				}
+
+				bool QueryNativeSetter(const std::type_info& signature, void* invoker)override
+				{
+					if constexpr (std::is_copy_assignable_v<TField>)
+					{
+						if (signature != typeid(void(TClass*, const TField&))) return false;
+						*static_cast<Func<void(TClass*, const TField&)>*>(invoker) = [fieldRef = fieldRef](TClass* object, const TField& value)
+						{
+							object->*fieldRef = value;
+						};
+						return true;
+					}
+					else
+					{
+						return false;
+					}
+				}
+
 				bool IsWritable()override
 				{
 					return std::is_copy_assignable_v<TField>;
@@ -844,7 +1075,7 @@ StructTypeDescriptor
 
 					Value GetValueInternal(const Value& thisObject)override
 					{
-						auto structValue = thisObject.GetBoxedValue().Cast<IValueType::TypedBox<T>>();
+						auto structValue = IValueType::TypedBox<T>::From(thisObject.GetBoxedValueRawPtr());
 						if (!structValue)
 						{
 							throw ArgumentTypeMismtatchException(L"thisObject", GetOwnerTypeDescriptor(), Value::BoxedValue, thisObject);
@@ -854,7 +1085,7 @@ StructTypeDescriptor
 
 					void SetValueInternal(Value& thisObject, const Value& newValue)override
 					{
-						auto structValue = thisObject.GetBoxedValue().Cast<IValueType::TypedBox<T>>();
+						auto structValue = IValueType::TypedBox<T>::From(thisObject.GetMutableBoxedValue().Obj());
 						if (!structValue)
 						{
 							throw ArgumentTypeMismtatchException(L"thisObject", GetOwnerTypeDescriptor(), Value::BoxedValue, thisObject);
@@ -872,6 +1103,40 @@ StructTypeDescriptor
 					{
 						return nullptr;
 					}
+
+					bool QueryNativeGetter(const std::type_info& signature, void* invoker)override
+					{
+						if constexpr (std::is_copy_constructible_v<TField>)
+						{
+							if (signature != typeid(TField(T*))) return false;
+							*static_cast<Func<TField(T*)>*>(invoker) = [field = field](T* object)->TField
+							{
+								return object->*field;
+							};
+							return true;
+						}
+						else
+						{
+							return false;
+						}
+					}
+
+					bool QueryNativeSetter(const std::type_info& signature, void* invoker)override
+					{
+						if constexpr (std::is_copy_assignable_v<TField>)
+						{
+							if (signature != typeid(void(T*, const TField&))) return false;
+							*static_cast<Func<void(T*, const TField&)>*>(invoker) = [field = field](T* object, const TField& value)
+							{
+								object->*field = value;
+							};
+							return true;
+						}
+						else
+						{
+							return false;
+						}
+					}
 				};
 
 			protected:
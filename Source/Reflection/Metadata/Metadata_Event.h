@@ -67,27 +67,28 @@ CustomEventInfoImpl<void(TArgs...)>
 
 				Ptr<IEventHandler> AttachInternal(DescriptableObject* thisObject, Ptr<IValueFunctionProxy> handler)override
 				{
-					TClass* object = UnboxValue<TClass*>(Value::From(thisObject), GetOwnerTypeDescriptor(), L"thisObject");
+					TClass* object = UnboxValue<TClass*>(Value::From(thisObject), GetOwnerTypeDescriptor(), WString::Unmanaged(L"thisObject"));
 					Event<void(TArgs...)>& eventObject = object->*eventRef;
+
+					// arguments are boxed on the stack for each call, with type descriptors resolved once here
+					ITypeDescriptor* argumentTypes[sizeof...(TArgs) == 0 ? 1 : sizeof...(TArgs)] = { TypeInfoRetriver<TArgs>::CreateTypeInfo()->GetTypeDescriptor()... };
 					auto func = Func<void(TArgs...)>([=](TArgs ...args)
 						{
-							auto arguments = IValueList::Create();
-							BoxParametersToList(arguments, std::forward<TArgs>(args)...);
-							handler->Invoke(arguments);
+							InvokeFunctionProxy(handler, argumentTypes, args...);
 						});
 					return EventHelper<TArgs...>::Attach(eventObject, func);
 				}
 
 				bool DetachInternal(DescriptableObject* thisObject, Ptr<IEventHandler> handler)override
 				{
-					TClass* object = UnboxValue<TClass*>(Value::From(thisObject), GetOwnerTypeDescriptor(), L"thisObject");
+					TClass* object = UnboxValue<TClass*>(Value::From(thisObject), GetOwnerTypeDescriptor(), WString::Unmanaged(L"thisObject"));
 					Event<void(TArgs...)>& eventObject = object->*eventRef;
 					return EventHelper<TArgs...>::Detach(eventObject, handler);
 				}
 
 				void InvokeInternal(DescriptableObject* thisObject, Ptr<IValueReadonlyList> arguments)override
 				{
-					TClass* object = UnboxValue<TClass*>(Value::From(thisObject), GetOwnerTypeDescriptor(), L"thisObject");
+					TClass* object = UnboxValue<TClass*>(Value::From(thisObject), GetOwnerTypeDescriptor(), WString::Unmanaged(L"thisObject"));
 					Event<void(TArgs...)>& eventObject = object->*eventRef;
 					invoke_helper::InvokeObject<Event<void(TArgs...)>, TArgs...>(eventObject, nullptr, arguments);
 				}
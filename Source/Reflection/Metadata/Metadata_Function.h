@@ -27,16 +27,16 @@ CustomConstructorInfoImpl<R(TArgs...)>
 				using TClass = typename trait_helper::RemovePtr<std::remove_cvref_t<R>>::Type;
 			protected:
 
-				Value InvokeInternal(const Value& thisObject, collections::Array<Value>& arguments)override
+				Value InvokeInternal(const Value& thisObject, ValueSpan arguments)override
 				{
-					return BoxParameter(unboxcall_helper::Unbox<MakeArgPacks<TArgs...>>::template AndNew<TClass, R>(this, arguments));
+					return BoxParameter(unboxcall_helper::Unbox<MakeArgPacks<TArgs...>>::template AndNew<TClass, R>(GetParameterTypeDescriptors(), arguments), GetReturnTypeDescriptor());
 				}
  
 				Value CreateFunctionProxyInternal(const Value& thisObject)override
 				{
 					auto proxy = Func([](TArgs ...args)->R
 					{
-						R result = R(new TClass(args...));
+						R result = ConstructorAllocator<TClass>::template New<R>(args...);
 						return result;
 					});
 					return BoxParameter(proxy);
@@ -52,6 +52,16 @@ CustomConstructorInfoImpl<R(TArgs...)>
 				{
 					return nullptr;
 				}
+
+				bool QueryNativeInvoker(const std::type_info& signature, void* invoker)override
+				{
+					if (signature != typeid(R(TArgs...))) return false;
+					*static_cast<Func<R(TArgs...)>*>(invoker) = [](TArgs ...args)->R
+					{
+						return ConstructorAllocator<TClass>::template New<R>(std::forward<TArgs>(args)...);
+					};
+					return true;
+				}
 			};
  
 /***********************************************************************
@@ -101,15 +111,15 @@ CustomExternalMethodInfoImpl<TClass, R(TArgs...)>
 			protected:
 				R(__thiscall TClass::* method)(TArgs...);
  
-				Value InvokeInternal(const Value& thisObject, collections::Array<Value>& arguments)override
+				Value InvokeInternal(const Value& thisObject, ValueSpan arguments)override
 				{
-					TClass* object = UnboxValue<TClass*>(thisObject, GetOwnerTypeDescriptor(), L"thisObject");
-					return invoke_helper::InvokeMethod<TClass, R, TArgs...>(object, method, this, arguments);
+					TClass* object = UnboxValue<TClass*>(thisObject, GetOwnerTypeDescriptor(), WString::Unmanaged(L"thisObject"));
+					return invoke_helper::InvokeMethod<TClass, R, TArgs...>(object, method, GetParameterTypeDescriptors(), GetReturnTypeDescriptor(), arguments);
 				}
  
 				Value CreateFunctionProxyInternal(const Value& thisObject)override
 				{
-					TClass* object = UnboxValue<TClass*>(thisObject, GetOwnerTypeDescriptor(), L"thisObject");
+					TClass* object = UnboxValue<TClass*>(thisObject, GetOwnerTypeDescriptor(), WString::Unmanaged(L"thisObject"));
 					Func<R(TArgs...)> proxy(object, method);
 					return BoxParameter(proxy);
 				}
@@ -120,6 +130,16 @@ CustomExternalMethodInfoImpl<TClass, R(TArgs...)>
 				{
 					internal_helper::ConstructorArgumentAdder<TypeTuple<TArgs...>>::Add(this, parameterNames, 0);
 				}
+
+				bool QueryNativeInvoker(const std::type_info& signature, void* invoker)override
+				{
+					if (signature != typeid(R(TClass*, TArgs...))) return false;
+					*static_cast<Func<R(TClass*, TArgs...)>*>(invoker) = [method = method](TClass* object, TArgs ...args)->R
+					{
+						return (object->*method)(std::forward<TArgs>(args)...);
+					};
+					return true;
+				}
 			};
  
 			template<typename TClass, typename R, typename ...TArgs>
@@ -128,15 +148,15 @@ CustomExternalMethodInfoImpl<TClass, R(TArgs...)>
 			protected:
 				R(*method)(TClass*, TArgs...);
  
-				Value InvokeInternal(const Value& thisObject, collections::Array<Value>& arguments)override
+				Value InvokeInternal(const Value& thisObject, ValueSpan arguments)override
 				{
-					TClass* object = UnboxValue<TClass*>(thisObject, GetOwnerTypeDescriptor(), L"thisObject");
-					return invoke_helper::InvokeExternal<TClass, R, TArgs...>(object, method, this, arguments);
+					TClass* object = UnboxValue<TClass*>(thisObject, GetOwnerTypeDescriptor(), WString::Unmanaged(L"thisObject"));
+					return invoke_helper::InvokeExternal<TClass, R, TArgs...>(object, method, GetParameterTypeDescriptors(), GetReturnTypeDescriptor(), arguments);
 				}
  
 				Value CreateFunctionProxyInternal(const Value& thisObject)override
 				{
-					TClass* object = UnboxValue<TClass*>(thisObject, GetOwnerTypeDescriptor(), L"thisObject");
+					TClass* object = UnboxValue<TClass*>(thisObject, GetOwnerTypeDescriptor(), WString::Unmanaged(L"thisObject"));
 					auto proxy = Func([object, this](TArgs... args)->decltype(auto) { return method(object, args...); });
 					return BoxParameter(proxy);
 				}
@@ -147,6 +167,13 @@ CustomExternalMethodInfoImpl<TClass, R(TArgs...)>
 				{
 					internal_helper::ConstructorArgumentAdder<TypeTuple<TArgs...>>::Add(this, parameterNames, 0);
 				}
+
+				bool QueryNativeInvoker(const std::type_info& signature, void* invoker)override
+				{
+					if (signature != typeid(R(TClass*, TArgs...))) return false;
+					*static_cast<Func<R(TClass*, TArgs...)>*>(invoker) = Func<R(TClass*, TArgs...)>(method);
+					return true;
+				}
 			};
  
 /***********************************************************************
@@ -159,9 +186,9 @@ CustomStaticMethodInfoImpl<R(TArgs...)>
 			protected:
 				R(* method)(TArgs...);
  
-				Value InvokeInternal(const Value& thisObject, collections::Array<Value>& arguments)override
+				Value InvokeInternal(const Value& thisObject, ValueSpan arguments)override
 				{
-					return invoke_helper::InvokeFunction<R, TArgs...>(method, this, arguments);
+					return invoke_helper::InvokeFunction<R, TArgs...>(method, GetParameterTypeDescriptors(), GetReturnTypeDescriptor(), arguments);
 				}
  
 				Value CreateFunctionProxyInternal(const Value& thisObject)override
@@ -176,6 +203,13 @@ CustomStaticMethodInfoImpl<R(TArgs...)>
 				{
 					internal_helper::ConstructorArgumentAdder<TypeTuple<TArgs...>>::Add(this, parameterNames, 0);
 				}
+
+				bool QueryNativeInvoker(const std::type_info& signature, void* invoker)override
+				{
+					if (signature != typeid(R(TArgs...))) return false;
+					*static_cast<Func<R(TArgs...)>*>(invoker) = Func<R(TArgs...)>(method);
+					return true;
+				}
 			};
 #endif
 		}
@@ -128,6 +128,327 @@ IValueDictionary
 				return Ptr(new ValueDictionaryWrapper<Ptr<Dictionary<Value, Value>>>(dictionary));
 			}
 
+/***********************************************************************
+IValueDictionary (hashed)
+***********************************************************************/
+
+			class ValueHashDictionary : public Object, public IValueDictionary
+			{
+			protected:
+				// keys, values and hashes are stored in the order of insertion, except that removing an entry moves the last entry to its position
+				// buckets stores indices to entries with linear probing, -1 means an empty bucket
+				List<Value>						keys;
+				List<Value>						values;
+				List<vuint64_t>					hashes;
+				Array<vint>						buckets;
+				Ptr<IValueReadonlyList>			keysWrapper;
+				Ptr<IValueReadonlyList>			valuesWrapper;
+
+				vint GetBucketMask()
+				{
+					return buckets.Count() - 1;
+				}
+
+				vint FindBucket(const Value& key, vuint64_t hash)
+				{
+					if (buckets.Count() == 0) return -1;
+					vint mask = GetBucketMask();
+					vint bucket = (vint)(hash & (vuint64_t)mask);
+					while (true)
+					{
+						vint index = buckets[bucket];
+						if (index == -1) return bucket;
+						if (hashes[index] == hash && keys[index] == key) return bucket;
+						bucket = (bucket + 1) & mask;
+					}
+				}
+
+				vint FindBucketOfEntry(vint index)
+				{
+					vint mask = GetBucketMask();
+					vint bucket = (vint)(hashes[index] & (vuint64_t)mask);
+					while (buckets[bucket] != index)
+					{
+						bucket = (bucket + 1) & mask;
+					}
+					return bucket;
+				}
+
+				void Rehash(vint bucketCount)
+				{
+					buckets.Resize(bucketCount);
+					for (vint i = 0; i < bucketCount; i++)
+					{
+						buckets[i] = -1;
+					}
+
+					vint mask = GetBucketMask();
+					for (vint i = 0; i < keys.Count(); i++)
+					{
+						vint bucket = (vint)(hashes[i] & (vuint64_t)mask);
+						while (buckets[bucket] != -1)
+						{
+							bucket = (bucket + 1) & mask;
+						}
+						buckets[bucket] = i;
+					}
+				}
+
+				void RemoveBucket(vint bucket)
+				{
+					// shift following entries back so that every entry is still reachable from its home bucket
+					vint mask = GetBucketMask();
+					vint hole = bucket;
+					vint current = (bucket + 1) & mask;
+					while (buckets[current] != -1)
+					{
+						vint home = (vint)(hashes[buckets[current]] & (vuint64_t)mask);
+						if (((current - home) & mask) >= ((current - hole) & mask))
+						{
+							buckets[hole] = buckets[current];
+							hole = current;
+						}
+						current = (current + 1) & mask;
+					}
+					buckets[hole] = -1;
+				}
+
+			public:
+				Ptr<IValueReadonlyList> GetKeys()override
+				{
+					if (!keysWrapper)
+					{
+						keysWrapper = UnboxValue<Ptr<IValueReadonlyList>>(BoxParameter(keys));
+					}
+					return keysWrapper;
+				}
+
+				Ptr<IValueReadonlyList> GetValues()override
+				{
+					if (!valuesWrapper)
+					{
+						valuesWrapper = UnboxValue<Ptr<IValueReadonlyList>>(BoxParameter(values));
+					}
+					return valuesWrapper;
+				}
+
+				vint GetCount()override
+				{
+					return keys.Count();
+				}
+
+				Value Get(const Value& key)override
+				{
+					vint bucket = FindBucket(key, key.GetHashCode());
+					if (bucket == -1 || buckets[bucket] == -1)
+					{
+						throw Exception(WString::Unmanaged(L"IValueDictionary::Get(const Value&)#The key does not exist."));
+					}
+					return values[buckets[bucket]];
+				}
+
+				void Set(const Value& key, const Value& value)override
+				{
+					vuint64_t hash = key.GetHashCode();
+					vint bucket = FindBucket(key, hash);
+					if (bucket != -1 && buckets[bucket] != -1)
+					{
+						values.Set(buckets[bucket], value);
+						return;
+					}
+
+					// keep the load factor no more than 1/2
+					if ((keys.Count() + 1) * 2 > buckets.Count())
+					{
+						Rehash(buckets.Count() == 0 ? 16 : buckets.Count() * 2);
+						bucket = FindBucket(key, hash);
+					}
+
+					buckets[bucket] = keys.Add(key);
+					values.Add(value);
+					hashes.Add(hash);
+				}
+
+				bool Remove(const Value& key)override
+				{
+					vint bucket = FindBucket(key, key.GetHashCode());
+					if (bucket == -1 || buckets[bucket] == -1) return false;
+
+					vint index = buckets[bucket];
+					RemoveBucket(bucket);
+
+					// move the last entry to the removed one to keep entries compact
+					vint last = keys.Count() - 1;
+					if (index != last)
+					{
+						buckets[FindBucketOfEntry(last)] = index;
+						keys.Set(index, keys[last]);
+						values.Set(index, values[last]);
+						hashes.Set(index, hashes[last]);
+					}
+					keys.RemoveAt(last);
+					values.RemoveAt(last);
+					hashes.RemoveAt(last);
+					return true;
+				}
+
+				void Clear()override
+				{
+					keys.Clear();
+					values.Clear();
+					hashes.Clear();
+					buckets.Resize(0);
+				}
+			};
+
+			Ptr<IValueDictionary> IValueDictionary::CreateHashed()
+			{
+				return Ptr(new ValueHashDictionary);
+			}
+
+			Ptr<IValueDictionary> IValueDictionary::CreateHashed(Ptr<IValueReadonlyDictionary> values)
+			{
+				return CreateHashed(GetLazyList<Value, Value>(values));
+			}
+
+			Ptr<IValueDictionary> IValueDictionary::CreateHashed(collections::LazyList<collections::Pair<Value, Value>> values)
+			{
+				auto dictionary = Ptr(new ValueHashDictionary);
+				for (auto&& pair : values)
+				{
+					dictionary->Set(pair.key, pair.value);
+				}
+				return dictionary;
+			}
+
+/***********************************************************************
+IValueInterfaceProxy and IValueFunctionProxy
+***********************************************************************/
+
+			class ReadonlyArgumentList : public Object, public IValueReadonlyList
+			{
+			protected:
+				static const vint				InlineCapacity = 8;
+
+				// arguments are copied to inlineArguments when possible, so that the list itself is the only allocation
+				Value							inlineArguments[InlineCapacity];
+				Array<Value>					extraArguments;
+				Value*							arguments = nullptr;
+				vint							count = 0;
+
+				class Enumerator : public Object, public IValueEnumerator
+				{
+				protected:
+					Ptr<ReadonlyArgumentList>		list;
+					vint							index = -1;
+
+				public:
+					Enumerator(Ptr<ReadonlyArgumentList> _list)
+						:list(_list)
+					{
+					}
+
+					Value GetCurrent()override
+					{
+						return list->Get(index);
+					}
+
+					vint GetIndex()override
+					{
+						return index;
+					}
+
+					bool Next()override
+					{
+						if (index + 1 >= list->count) return false;
+						index++;
+						return true;
+					}
+				};
+
+			public:
+				ReadonlyArgumentList(ValueSpan values)
+					:count(values.Count())
+				{
+					if (count <= InlineCapacity)
+					{
+						arguments = inlineArguments;
+					}
+					else
+					{
+						extraArguments.Resize(count);
+						arguments = &extraArguments[0];
+					}
+
+					for (vint i = 0; i < count; i++)
+					{
+						arguments[i] = values[i];
+					}
+				}
+
+				Ptr<IValueEnumerator> CreateEnumerator()override
+				{
+					return Ptr(new Enumerator(Ptr(this)));
+				}
+
+				vint GetCount()override
+				{
+					return count;
+				}
+
+				Value Get(vint index)override
+				{
+					CHECK_ERROR(0 <= index && index < count, L"IValueReadonlyList::Get(vint)#Argument index not in range.");
+					return arguments[index];
+				}
+
+				bool Contains(const Value& value)override
+				{
+					return IndexOf(value) != -1;
+				}
+
+				vint IndexOf(const Value& value)override
+				{
+					for (vint i = 0; i < count; i++)
+					{
+						if (arguments[i] == value) return i;
+					}
+					return -1;
+				}
+			};
+
+			BEGIN_GLOBAL_STORAGE_CLASS(EmptyArgumentListStorage)
+				Ptr<IValueReadonlyList> emptyArguments;
+
+				INITIALIZE_GLOBAL_STORAGE_CLASS
+					emptyArguments = Ptr(new ReadonlyArgumentList(ValueSpan()));
+
+				FINALIZE_GLOBAL_STORAGE_CLASS
+					emptyArguments = nullptr;
+
+			END_GLOBAL_STORAGE_CLASS(EmptyArgumentListStorage)
+
+			Ptr<IValueReadonlyList> CreateReadonlyArgumentList(ValueSpan arguments)
+			{
+				if (arguments.Count() == 0)
+				{
+					// the empty list is immutable, so it is shared by all calls without arguments
+					// it is released in FinalizeGlobalStorage
+					return GetEmptyArgumentListStorage().emptyArguments;
+				}
+				return Ptr(new ReadonlyArgumentList(arguments));
+			}
+
+			Value IValueInterfaceProxy::InvokeInPlace(IMethodInfo* methodInfo, ValueSpan arguments)
+			{
+				return Invoke(methodInfo, CreateReadonlyArgumentList(arguments));
+			}
+
+			Value IValueFunctionProxy::InvokeInPlace(ValueSpan arguments)
+			{
+				return Invoke(CreateReadonlyArgumentList(arguments));
+			}
+
 /***********************************************************************
 IValueException
 ***********************************************************************/
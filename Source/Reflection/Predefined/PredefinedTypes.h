@@ -736,6 +736,21 @@ Collections
 				/// <returns>The created dictionary.</returns>
 				/// <param name="values">Elements to copy.</param>
 				static Ptr<IValueDictionary>	Create(collections::LazyList<collections::Pair<Value, Value>> values);
+
+				/// <summary>Create an empty dictionary using a hash table.</summary>
+				/// <returns>The created dictionary.</returns>
+				/// <remarks>Keys are hashed by <see cref="Value::GetHashCode"/>, and they are not sorted. Removing a key moves the last key to its position.</remarks>
+				static Ptr<IValueDictionary>	CreateHashed();
+
+				/// <summary>Create a dictionary using a hash table with elements copied from another readonly dictionary.</summary>
+				/// <returns>The created dictionary.</returns>
+				/// <param name="values">Elements to copy.</param>
+				static Ptr<IValueDictionary>	CreateHashed(Ptr<IValueReadonlyDictionary> values);
+
+				/// <summary>Create a dictionary using a hash table with elements copied from another lazy list.</summary>
+				/// <returns>The created dictionary.</returns>
+				/// <param name="values">Elements to copy.</param>
+				static Ptr<IValueDictionary>	CreateHashed(collections::LazyList<collections::Pair<Value, Value>> values);
 			};
 
 /***********************************************************************
@@ -746,6 +761,16 @@ Interface Implementation Proxy
 			{
 			public:
 				virtual Value					Invoke(IMethodInfo* methodInfo, Ptr<IValueReadonlyList> arguments) = 0;
+
+				/// <summary>Call a method with arguments that are only alive during this call.</summary>
+				/// <returns>Return value from the method.</returns>
+				/// <param name="methodInfo">The method to call.</param>
+				/// <param name="arguments">Arguments to call the method.</param>
+				/// <remarks>
+				/// The default implementation copies arguments to a readonly list in one allocation, and calls the other overload.
+				/// A proxy could override this function to read arguments in place.
+				/// </remarks>
+				virtual Value					InvokeInPlace(IMethodInfo* methodInfo, ValueSpan arguments);
 			};
 
 			/// <summary>A reflectable version of <see cref="Func`1"/>.</summary>
@@ -757,6 +782,15 @@ Interface Implementation Proxy
 				/// <returns>Return value from the function.</returns>
 				/// <param name="arguments">Arguments to call the function.</param>
 				virtual Value					Invoke(Ptr<IValueReadonlyList> arguments) = 0;
+
+				/// <summary>Call the function with arguments that are only alive during this call.</summary>
+				/// <returns>Return value from the function.</returns>
+				/// <param name="arguments">Arguments to call the function.</param>
+				/// <remarks>
+				/// The default implementation copies arguments to a readonly list in one allocation, and calls the other overload.
+				/// A function could override this function to read arguments in place.
+				/// </remarks>
+				virtual Value					InvokeInPlace(ValueSpan arguments);
 			};
 
 			/// <summary>A reflectable subscription, usually created by the <b>bind</b> expression in Workflow script.</summary>
@@ -72,6 +72,69 @@ namespace vl
 				}
 			};
 
+			struct InterfaceProxyMethodSlot
+			{
+				MethodPointerBinaryData					data;
+				std::atomic<IMethodInfo*>				methodInfo;
+				InterfaceProxyMethodSlot*				next;
+			};
+
+			template<typename TInterface>
+			struct InterfaceProxyMethodSlots
+			{
+				// slots are only added and never removed, filled by the first call after the interface loads, and cleared when it unloads
+				static inline std::atomic<InterfaceProxyMethodSlot*>	head{ nullptr };
+
+				static void Register(InterfaceProxyMethodSlot* slot)
+				{
+					auto first = head.load(std::memory_order_acquire);
+					do
+					{
+						slot->next = first;
+					} while (!head.compare_exchange_weak(first, slot, std::memory_order_release, std::memory_order_acquire));
+				}
+
+				static void Clear()
+				{
+					for (auto slot = head.load(std::memory_order_acquire); slot; slot = slot->next)
+					{
+						slot->methodInfo.store(nullptr, std::memory_order_release);
+					}
+				}
+			};
+
+			template<typename TInterface>
+			class InterfaceProxyMethodSlotOf : protected InterfaceProxyMethodSlot
+			{
+			public:
+				template<typename T>
+				InterfaceProxyMethodSlotOf(T methodPointer)
+				{
+					MethodPointerBinaryDataRetriver<T> binaryData(methodPointer);
+					data = binaryData.GetBinaryData();
+					methodInfo.store(nullptr, std::memory_order_relaxed);
+					InterfaceProxyMethodSlots<TInterface>::Register(this);
+				}
+
+				IMethodInfo* GetMethodInfo()
+				{
+					if (auto cached = methodInfo.load(std::memory_order_acquire))
+					{
+						return cached;
+					}
+
+					// the first call, or the interface has been reloaded
+					// GetIndexedMethodInfo waits for the interface to load, so a published slot never points to a method of a loading interface
+					auto td = GetTypeDescriptor<TInterface>();
+					CHECK_ERROR(td != nullptr, L"Internal error: The type of this interface has not been registered.");
+					auto impl = dynamic_cast<MethodPointerBinaryData::IIndexer*>(td);
+					CHECK_ERROR(impl != nullptr, L"Internal error: BEGIN_INTERFACE_PROXY is the only correct way to register an interface with a proxy.");
+					auto indexed = impl->GetIndexedMethodInfo(data);
+					methodInfo.store(indexed, std::memory_order_release);
+					return indexed;
+				}
+			};
+
 			template<typename T, TypeDescriptorFlags TDFlags>
 			struct MethodPointerBinaryDataRecorder
 			{
@@ -244,37 +307,53 @@ InterfaceProxy::Invoke
 				return nullptr;
 			}
 
+			template<typename T>
+			Value BoxInterfaceProxyArgument(T&& argument)
+			{
+				if constexpr (std::is_same_v<std::remove_cvref_t<T>, Value>)
+				{
+					return std::forward<T>(argument);
+				}
+				else
+				{
+					return BoxParameter(std::forward<T>(argument));
+				}
+			}
+
+			inline Value InvokeInterfaceProxy(const Ptr<IValueInterfaceProxy>& proxy, IMethodInfo* methodInfo)
+			{
+				return proxy->InvokeInPlace(methodInfo, ValueSpan());
+			}
+
+			template<typename ...TArguments>
+			Value InvokeInterfaceProxy(const Ptr<IValueInterfaceProxy>& proxy, IMethodInfo* methodInfo, TArguments&& ...arguments)
+			{
+				// arguments are boxed on the stack, the proxy decides whether to copy them or not
+				Value boxedArguments[] = { BoxInterfaceProxyArgument(std::forward<TArguments>(arguments))... };
+				return proxy->InvokeInPlace(methodInfo, ValueSpan(boxedArguments));
+			}
+
 #define PREPARE_INVOKE_INTERFACE_PROXY(METHODNAME, ...)\
-			static ITypeDescriptor* _interface_proxy_typeDescriptor = nullptr;\
-			static IMethodInfo* _interface_proxy_methodInfo = nullptr;\
-			if (_interface_proxy_typeDescriptor != static_cast<DescriptableObject*>(this)->GetTypeDescriptor())\
-			{\
-				_interface_proxy_typeDescriptor = static_cast<DescriptableObject*>(this)->GetTypeDescriptor();\
-				CHECK_ERROR(_interface_proxy_typeDescriptor != nullptr, L"Internal error: The type of this interface has not been registered.");\
-				auto impl = dynamic_cast<MethodPointerBinaryData::IIndexer*>(_interface_proxy_typeDescriptor);\
-				CHECK_ERROR(impl != nullptr, L"Internal error: BEGIN_INTERFACE_PROXY is the only correct way to register an interface with a proxy.");\
-				auto _interface_proxy_method\
-					= (decltype(MethodTypeTrait<_interface_proxy_InterfaceType, decltype(METHODNAME(__VA_ARGS__))>(__VA_ARGS__)))\
-					&_interface_proxy_InterfaceType::METHODNAME;\
-				MethodPointerBinaryDataRetriver<decltype(_interface_proxy_method)> binaryData(_interface_proxy_method);\
-				_interface_proxy_methodInfo = impl->GetIndexedMethodInfo(binaryData.GetBinaryData());\
-			}\
+			static InterfaceProxyMethodSlotOf<_interface_proxy_InterfaceType> _interface_proxy_slot(\
+				(decltype(MethodTypeTrait<_interface_proxy_InterfaceType, decltype(METHODNAME(__VA_ARGS__))>(__VA_ARGS__)))\
+				&_interface_proxy_InterfaceType::METHODNAME);\
+			auto _interface_proxy_methodInfo = _interface_proxy_slot.GetMethodInfo();\
 
 #define INVOKE_INTERFACE_PROXY(METHODNAME, ...)\
 			PREPARE_INVOKE_INTERFACE_PROXY(METHODNAME, __VA_ARGS__)\
-			proxy->Invoke(_interface_proxy_methodInfo, IValueList::Create(collections::From((collections::Array<Value>&)(Value_xs(), __VA_ARGS__))))
+			InvokeInterfaceProxy(proxy, _interface_proxy_methodInfo, __VA_ARGS__)
 
 #define INVOKE_INTERFACE_PROXY_NOPARAMS(METHODNAME)\
 			PREPARE_INVOKE_INTERFACE_PROXY(METHODNAME)\
-			proxy->Invoke(_interface_proxy_methodInfo, IValueList::Create())
+			InvokeInterfaceProxy(proxy, _interface_proxy_methodInfo)
 
 #define INVOKEGET_INTERFACE_PROXY(METHODNAME, ...)\
 			PREPARE_INVOKE_INTERFACE_PROXY(METHODNAME, __VA_ARGS__)\
-			return UnboxParameter<decltype(METHODNAME(__VA_ARGS__))>(proxy->Invoke(_interface_proxy_methodInfo, IValueList::Create(collections::From((collections::Array<Value>&)(Value_xs(), __VA_ARGS__))))).Ref()
+			return UnboxParameter<decltype(METHODNAME(__VA_ARGS__))>(InvokeInterfaceProxy(proxy, _interface_proxy_methodInfo, __VA_ARGS__)).Ref()
 
 #define INVOKEGET_INTERFACE_PROXY_NOPARAMS(METHODNAME)\
 			PREPARE_INVOKE_INTERFACE_PROXY(METHODNAME)\
-			return UnboxParameter<decltype(METHODNAME())>(proxy->Invoke(_interface_proxy_methodInfo, IValueList::Create())).Ref()
+			return UnboxParameter<decltype(METHODNAME())>(InvokeInterfaceProxy(proxy, _interface_proxy_methodInfo)).Ref()
 
 /***********************************************************************
 Enum
@@ -417,6 +496,7 @@ Interface
 					}\
 					~CustomTypeDescriptorImpl()\
 					{\
+						InterfaceProxyMethodSlots<TYPENAME>::Clear();\
 						Description<TYPENAME>::SetAssociatedTypeDescriptor(0);\
 					}\
 					void IndexMethodInfo(const MethodPointerBinaryData& data, IMethodInfo* methodInfo)override\
@@ -401,8 +401,8 @@ LoadPredefinedTypes
 
 				CLASS_MEMBER_METHOD(GetParameter, { L"index" })
 				CLASS_MEMBER_METHOD(IsStatic, NO_PARAMETER)
-				CLASS_MEMBER_METHOD(CheckArguments, { L"arguments" })
-				CLASS_MEMBER_METHOD(Invoke, { L"thisObject" _ L"arguments" })
+				CLASS_MEMBER_METHOD_OVERLOAD(CheckArguments, { L"arguments" }, void(IMethodInfo::*)(collections::Array<Value>&))
+				CLASS_MEMBER_METHOD_OVERLOAD(Invoke, { L"thisObject" _ L"arguments" }, Value(IMethodInfo::*)(const Value&, collections::Array<Value>&))
 				CLASS_MEMBER_BASE(IMemberInfo)
 			END_INTERFACE_MEMBER(IMethodInfo)
 
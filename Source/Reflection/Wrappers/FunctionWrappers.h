@@ -53,6 +53,19 @@ Function Wrappers
 					}
 					return invoke_helper::InvokeObject<FunctionType, TArgs...>(function, nullptr, arguments);
 				}
+
+				Value InvokeInPlace(ValueSpan arguments)override
+				{
+					if (arguments.Count() != sizeof...(TArgs))
+					{
+#ifdef VCZH_DESCRIPTABLEOBJECT_WITH_METADATA
+						throw ArgumentCountMismtatchException();
+#else
+						CHECK_FAIL(L"Argument count mismatch.");
+#endif
+					}
+					return invoke_helper::InvokeObject<FunctionType, TArgs...>(function, nullptr, nullptr, arguments);
+				}
 			};
 		}
 	}
@@ -8,6 +8,63 @@ using namespace vl::collections;
 using namespace vl::reflection;
 using namespace vl::reflection::description;
 
+// heap allocations are counted by a CRT allocation hook when checking memory leaks
+// otherwise they are counted by malloc replaced in TestReflection.cpp when glibc is used
+#if defined(VCZH_CHECK_MEMORY_LEAKS) || defined(__GLIBC__)
+#define ALLOCATION_COUNTER_COUNTS_HEAP
+#endif
+
+namespace allocation_counter
+{
+	inline thread_local bool counting = false;
+	inline thread_local vint heapAllocations = 0;
+
+#ifdef VCZH_CHECK_MEMORY_LEAKS
+	inline int CountAllocation(int allocType, void*, size_t, int blockType, long, const unsigned char*, int)
+	{
+		if (counting && blockType != _CRT_BLOCK && (allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC))
+		{
+			heapAllocations++;
+		}
+		return 1;
+	}
+#endif
+}
+
+// counts memory allocated in the current thread
+// boxed values could be taken from the pool for IValueType::TypedBox<T> without touching the heap, they are counted through the pool statistics
+class AllocationCounter
+{
+protected:
+#ifdef VCZH_CHECK_MEMORY_LEAKS
+	_CRT_ALLOC_HOOK		previousHook = nullptr;
+#endif
+
+public:
+	AllocationCounter()
+	{
+#ifdef VCZH_CHECK_MEMORY_LEAKS
+		previousHook = _CrtSetAllocHook(&allocation_counter::CountAllocation);
+#endif
+		ResetBoxedValuePoolStatistics();
+		allocation_counter::heapAllocations = 0;
+		allocation_counter::counting = true;
+	}
+
+	~AllocationCounter()
+	{
+		allocation_counter::counting = false;
+#ifdef VCZH_CHECK_MEMORY_LEAKS
+		_CrtSetAllocHook(previousHook);
+#endif
+	}
+
+	vint Count()
+	{
+		return allocation_counter::heapAllocations + (vint)GetBoxedValuePoolStatistics().allocations;
+	}
+};
+
 #define TEST_CASE_REFLECTION_BODY(NAME)\
 		try\
 		{\
@@ -106,5 +106,124 @@ TEST_FILE
 		}
 	});
 
+	TEST_CASE(L"Test DescriptableObject: Inline primitive values")
+	{
+		{
+			auto value = BoxValue<vint32_t>(100);
+			TEST_ASSERT(value.GetValueType() == Value::BoxedValue);
+			TEST_ASSERT(value.GetInlineBoxableType() == PredefinedBoxableType::PBT_S32);
+			TEST_ASSERT(UnboxValue<vint32_t>(value) == 100);
+
+			auto boxed = value.GetBoxedValue();
+			TEST_ASSERT(boxed->GetBoxableType() == PredefinedBoxableType::PBT_S32);
+			TEST_ASSERT(boxed.Cast<IValueType::TypedBox<vint32_t>>()->value == 100);
+
+			auto copied = value;
+			TEST_ASSERT(copied.GetInlineBoxableType() == PredefinedBoxableType::PBT_S32);
+			TEST_ASSERT(UnboxValue<vint32_t>(copied) == 100);
+			TEST_ASSERT(copied == value);
+		}
+		{
+			auto value = BoxValue<bool>(true);
+			TEST_ASSERT(value.GetInlineBoxableType() == PredefinedBoxableType::PBT_BOOL);
+			TEST_ASSERT(UnboxValue<bool>(value) == true);
+		}
+		{
+			auto value = BoxValue<double>(1.5);
+			TEST_ASSERT(value.GetInlineBoxableType() == PredefinedBoxableType::PBT_F64);
+			TEST_ASSERT(UnboxValue<double>(value) == 1.5);
+		}
+		{
+			auto value = BoxValue<wchar_t>(L'x');
+			TEST_ASSERT(value.GetInlineBoxableType() == PredefinedBoxableType::PBT_WCHAR);
+			TEST_ASSERT(UnboxValue<wchar_t>(value) == L'x');
+		}
+		{
+			auto value = Value::From(Ptr(new IValueType::TypedBox<vuint8_t>(200)), nullptr);
+			TEST_ASSERT(value.GetInlineBoxableType() == PredefinedBoxableType::PBT_U8);
+			TEST_ASSERT(UnboxValue<vuint8_t>(value) == 200);
+		}
+		{
+			auto value = BoxValue<WString>(L"abc");
+			TEST_ASSERT(value.GetInlineBoxableType() == PredefinedBoxableType::PBT_Unknown);
+			TEST_ASSERT(value.GetBoxedValue()->GetBoxableType() == PredefinedBoxableType::PBT_STRING);
+		}
+	});
+
+	TEST_CASE(L"Test DescriptableObject: Copying and moving values")
+	{
+		{
+			auto value = BoxValue<WString>(L"abc");
+			auto boxed = value.GetBoxedValue();
+
+			Value copied = value;
+			TEST_ASSERT(copied.GetBoxedValue() == boxed);
+			TEST_ASSERT(copied.GetMutableBoxedValue() != boxed);
+			TEST_ASSERT(value.GetBoxedValue() == boxed);
+			TEST_ASSERT(UnboxValue<WString>(copied) == L"abc");
+
+			Value moved = std::move(value);
+			TEST_ASSERT(value.IsNull());
+			TEST_ASSERT(moved.GetBoxedValue() == boxed);
+			TEST_ASSERT(UnboxValue<WString>(moved) == L"abc");
+
+			value = std::move(moved);
+			TEST_ASSERT(moved.IsNull());
+			TEST_ASSERT(value.GetBoxedValue() == boxed);
+		}
+		{
+			auto base = Ptr(new Base);
+			auto value = BoxValue<Ptr<Base>>(base);
+			Value moved = std::move(value);
+			TEST_ASSERT(value.IsNull());
+			TEST_ASSERT(value.GetRawPtr() == nullptr);
+			TEST_ASSERT(moved.GetValueType() == Value::SharedPtr);
+			TEST_ASSERT(UnboxValue<Ptr<Base>>(moved) == base);
+		}
+	});
+
+	TEST_CASE(L"Test DescriptableObject: Pooling boxed values")
+	{
+		ResetBoxedValuePoolStatistics();
+		for (vint i = 0; i < 10; i++)
+		{
+			auto value = BoxValue<WString>(itow(i));
+			auto copied = value.GetBoxedValue()->Copy();
+			TEST_ASSERT(copied.Cast<IValueType::TypedBox<WString>>()->value == itow(i));
+		}
+		auto statistics = GetBoxedValuePoolStatistics();
+#ifdef VCZH_REFLECTION_NO_BOXED_VALUE_POOL
+		TEST_ASSERT(statistics.allocations == 0);
+#else
+		TEST_ASSERT(statistics.allocations == 20);
+		TEST_ASSERT(statistics.deallocations == 20);
+		TEST_ASSERT(statistics.hits >= 18);
+		TEST_ASSERT(statistics.recycles == 20);
+#endif
+	});
+
+	TEST_CASE(L"Test DescriptableObject: Draining boxed values")
+	{
+		BoxValue<WString>(L"abc");
+		DrainBoxedValuePools();
+		ResetBoxedValuePoolStatistics();
+		BoxValue<WString>(L"abc");
+		auto statistics = GetBoxedValuePoolStatistics();
+		TEST_ASSERT(statistics.hits == 0);
+	});
+
+	TEST_CASE(L"Test DescriptableObject: Unboxing by tags")
+	{
+		auto value = BoxValue<WString>(L"abc");
+		auto boxed = value.GetBoxedValueRawPtr();
+		TEST_ASSERT(boxed == value.GetBoxedValue().Obj());
+		TEST_ASSERT(boxed->GetBoxTag() == IValueType::TypedBox<WString>::GetTag());
+		TEST_ASSERT(boxed->GetBoxTag() != IValueType::TypedBox<Locale>::GetTag());
+		TEST_ASSERT(IValueType::TypedBox<WString>::From(boxed)->value == L"abc");
+		TEST_ASSERT(IValueType::TypedBox<Locale>::From(boxed) == nullptr);
+		TEST_ASSERT(BoxValue<vint>(1).GetBoxedValueRawPtr() == nullptr);
+		TEST_ASSERT(UnboxValue<WString>(value) == L"abc");
+	});
+
 #endif
 }
@@ -119,6 +119,96 @@ namespace reflection_test_boxunboxcollections
 		TEST_EXCEPTION(xs->Clear(), ObjectDisposedException, [](auto) {});
 	}
 
+	// a boxed value implemented outside of the library, which does not override GetBoxTag or GetHashCode
+	class CustomBoxedValue : public Object, public IBoxedValue
+	{
+	public:
+		vint value;
+
+		CustomBoxedValue(vint _value)
+			:value(_value)
+		{
+		}
+
+		PredefinedBoxableType GetBoxableType()override
+		{
+			return PredefinedBoxableType::PBT_Unknown;
+		}
+
+		Ptr<IBoxedValue> Copy()override
+		{
+			return Ptr(new CustomBoxedValue(value));
+		}
+
+		CompareResult ComparePrimitive(IBoxedValue* boxedValue)override
+		{
+			auto another = dynamic_cast<CustomBoxedValue*>(boxedValue);
+			if (!another) return NotComparable;
+			if (value < another->value) return Smaller;
+			if (value > another->value) return Greater;
+			return Equal;
+		}
+	};
+
+	void TestHashedDictionary()
+	{
+		auto xs = IValueDictionary::CreateHashed();
+		for (vint i = 0; i < 1000; i++)
+		{
+			xs->Set(BoxValue<vint>(i), BoxValue<WString>(itow(i)));
+			xs->Set(BoxValue<WString>(itow(i)), BoxValue<vint>(i));
+		}
+		TEST_ASSERT(xs->GetCount() == 2000);
+		TEST_ASSERT(xs->GetKeys()->GetCount() == 2000);
+
+		TEST_ASSERT(BoxValue<vint8_t>(10).GetHashCode() == BoxValue<vuint64_t>(10).GetHashCode());
+		TEST_ASSERT(BoxValue<vint32_t>(10).GetHashCode() == BoxValue<double>(10).GetHashCode());
+		TEST_ASSERT(BoxValue<double>(0.0).GetHashCode() == BoxValue<double>(-0.0).GetHashCode());
+		TEST_ASSERT(UnboxValue<WString>(xs->Get(BoxValue<vint8_t>(10))) == L"10");
+		TEST_ASSERT(UnboxValue<WString>(xs->Get(BoxValue<double>(10))) == L"10");
+		TEST_ASSERT(UnboxValue<vint>(xs->Get(BoxValue<WString>(L"10"))) == 10);
+
+		for (vint i = 0; i < 1000; i += 2)
+		{
+			TEST_ASSERT(xs->Remove(BoxValue<vint>(i)));
+			TEST_ASSERT(!xs->Remove(BoxValue<vint>(i)));
+		}
+		TEST_ASSERT(xs->GetCount() == 1500);
+		for (vint i = 0; i < 1000; i++)
+		{
+			if (i % 2 == 0)
+			{
+				TEST_EXCEPTION(xs->Get(BoxValue<vint>(i)), Exception, [](auto) {});
+			}
+			else
+			{
+				TEST_ASSERT(UnboxValue<WString>(xs->Get(BoxValue<vint>(i))) == itow(i));
+			}
+			TEST_ASSERT(UnboxValue<vint>(xs->Get(BoxValue<WString>(itow(i)))) == i);
+		}
+
+		xs->Set(BoxValue<WString>(L"10"), BoxValue<vint>(100));
+		TEST_ASSERT(xs->GetCount() == 1500);
+		TEST_ASSERT(UnboxValue<vint>(xs->Get(BoxValue<WString>(L"10"))) == 100);
+
+		auto ys = IValueDictionary::CreateHashed(Ptr<IValueReadonlyDictionary>(xs));
+		TEST_ASSERT(ys->GetCount() == 1500);
+		TEST_ASSERT(UnboxValue<vint>(ys->Get(BoxValue<WString>(L"10"))) == 100);
+
+		xs->Clear();
+		TEST_ASSERT(xs->GetCount() == 0);
+		TEST_ASSERT(xs->GetKeys()->GetCount() == 0);
+		TEST_ASSERT(ys->GetCount() == 1500);
+
+		auto customType = GetTypeDescriptor<Value>();
+		for (vint i = 0; i < 10; i++)
+		{
+			xs->Set(Value::From(Ptr(new CustomBoxedValue(i)), customType), BoxValue<vint>(i));
+		}
+		TEST_ASSERT(xs->GetCount() == 10);
+		TEST_ASSERT(UnboxValue<vint>(xs->Get(Value::From(Ptr(new CustomBoxedValue(5)), customType))) == 5);
+	}
+
 	void TestObservableList()
 	{
 		auto cs = Ptr(new ObservableList<vint>);
@@ -201,6 +291,7 @@ TEST_FILE
 	TEST_CASE_REFLECTION(TestList)
 	TEST_CASE_REFLECTION(TestSortedList)
 	TEST_CASE_REFLECTION(TestDictionary)
+	TEST_CASE_REFLECTION(TestHashedDictionary)
 	TEST_CASE_REFLECTION(TestObservableList)
 	TEST_CASE_REFLECTION(TestBoxingThenUnboxing)
 }
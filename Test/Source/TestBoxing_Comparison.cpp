@@ -179,6 +179,25 @@ namespace reflection_test
 		TestComparison<ValueToCompare>(a2, a1);
 	}
 
+	void TestCompareDifferentType()
+	{
+		auto i = BoxValue<vint32_t>(1);
+		auto s = BoxValue<WString>(WString::Unmanaged(L"a"));
+		auto v = BoxValue<ValueToCompare>({ L"a",1 });
+
+		unittest::UnitTest::PrintMessage(L"1 <=> a", unittest::UnitTest::MessageKind::Info);
+		TEST_ASSERT(std::is_neq(i <=> s));
+		TEST_ASSERT(std::is_neq(s <=> i));
+		unittest::UnitTest::PrintMessage(L"a <=> {a, 1}", unittest::UnitTest::MessageKind::Info);
+		TEST_ASSERT(std::is_neq(s <=> v));
+		TEST_ASSERT(std::is_neq(v <=> s));
+		unittest::UnitTest::PrintMessage(L"shared boxed values", unittest::UnitTest::MessageKind::Info);
+		auto s2 = s;
+		auto v2 = v;
+		TEST_ASSERT(s == s2);
+		TEST_ASSERT(v == v2);
+	}
+
 	template<typename T, typename U>
 	void TestCompareDifferentNumber()
 	{
@@ -225,6 +244,7 @@ TEST_FILE
 	TEST_CASE_REFLECTION(TestCompareString)
 	TEST_CASE_REFLECTION(TestCompareLocale)
 	TEST_CASE_REFLECTION(TestCompareStruct)
+	TEST_CASE_REFLECTION(TestCompareDifferentType)
 
 // workaround clang++ 14.0.0-1ubuntu1
 
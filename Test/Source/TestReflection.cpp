@@ -150,9 +150,42 @@ namespace TestReflection_TestObjects
 			CopyFrom(maps, value);
 		}
 	};
+
+	class PooledNode : public Object, public Description<PooledNode>
+	{
+	public:
+		static inline vint allocatedCount = 0;
+		vint value = 0;
+
+		PooledNode() = default;
+
+		PooledNode(vint _value)
+			:value(_value)
+		{
+		}
+	};
+
+	// registered and unregistered in test cases by synthetic type descriptors
+	class SwappableType
+	{
+	};
 }
 using namespace TestReflection_TestObjects;
 
+#if !defined(VCZH_CHECK_MEMORY_LEAKS) && defined(__GLIBC__)
+extern "C" void* __libc_malloc(size_t size);
+
+// collections and operator new allocate memory by malloc
+extern "C" void* malloc(size_t size)
+{
+	if (allocation_counter::counting)
+	{
+		allocation_counter::heapAllocations++;
+	}
+	return __libc_malloc(size);
+}
+#endif
+
 #define _ ,
 
 #define TYPE_LIST(F)\
@@ -166,11 +199,25 @@ using namespace TestReflection_TestObjects;
 	F(Size)\
 	F(Rect)\
 	F(RectPair)\
+	F(PooledNode)\
 
 BEGIN_TYPE_INFO_NAMESPACE
 
+	template<>
+	struct ConstructorAllocator<PooledNode>
+	{
+		template<typename R, typename ...TArgs>
+		static R New(TArgs&& ...args)
+		{
+			PooledNode::allocatedCount++;
+			return R(new PooledNode(std::forward<TArgs>(args)...));
+		}
+	};
+
 	TYPE_LIST(DECL_TYPE_INFO)
 	TYPE_LIST(IMPL_CPP_TYPE_INFO)
+	DECL_TYPE_INFO(SwappableType)
+	IMPL_TYPE_INFO_RENAME(SwappableType, synthetic::SwappableType)
 
 	BEGIN_ENUM_ITEM(Season)
 		ENUM_ITEM(Spring)
@@ -193,6 +240,12 @@ BEGIN_TYPE_INFO_NAMESPACE
 		CLASS_MEMBER_EXTERNALCTOR(Ptr<Base>(vint, vint), {L"_a" _ L"_b"}, Base::Create)
 	END_CLASS_MEMBER(Base)
 
+	BEGIN_CLASS_MEMBER(PooledNode)
+		CLASS_MEMBER_FIELD(value)
+		CLASS_MEMBER_CONSTRUCTOR(Ptr<PooledNode>(), NO_PARAMETER)
+		CLASS_MEMBER_CONSTRUCTOR(Ptr<PooledNode>(vint), {L"_value"})
+	END_CLASS_MEMBER(PooledNode)
+
 	BEGIN_CLASS_MEMBER(Derived)
 		CLASS_MEMBER_BASE(Base)
 		CLASS_MEMBER_CONSTRUCTOR(Ptr<Derived>(), NO_PARAMETER)
@@ -496,9 +549,17 @@ namespace reflection_test
 			Value a = value;
 			Value b;
 			b = value;
+			TEST_ASSERT(a.GetBoxedValue() == value.GetBoxedValue());
+			TEST_ASSERT(b.GetBoxedValue() == value.GetBoxedValue());
 
 			value.SetProperty(L"x", BoxValue<vint>(1));
 			value.SetProperty(L"y", BoxValue<vint>(2));
+			TEST_ASSERT(a.GetBoxedValue() != value.GetBoxedValue());
+			TEST_ASSERT(a.GetBoxedValue() == b.GetBoxedValue());
+
+			auto pv = UnboxValue<Point>(value);
+			TEST_ASSERT(pv.x == 1);
+			TEST_ASSERT(pv.y == 2);
 
 			auto pa = UnboxValue<Point>(a);
 			TEST_ASSERT(pa.x == 10);
@@ -508,6 +569,29 @@ namespace reflection_test
 			TEST_ASSERT(pb.x == 10);
 			TEST_ASSERT(pb.y == 20);
 		}
+		{
+			// a struct copied out of a reflected container is modified through reflection without touching the container
+			auto xs = IValueList::Create();
+			xs->Add(BoxValue<Point>({ 10, 20 }));
+			Value copied = xs->Get(0);
+			auto propertyX = GetTypeDescriptor<Point>()->GetPropertyByName(L"x", false);
+			propertyX->SetValue(copied, BoxValue<vint>(1));
+			TEST_ASSERT(UnboxValue<Point>(copied).x == 1);
+			TEST_ASSERT(UnboxValue<Point>(xs->Get(0)).x == 10);
+
+			// modifying a boxed value in place through GetMutableBoxedValue does not affect other copies
+			Value value = BoxValue<WString>(L"abc");
+			Value other = value;
+			IValueType::TypedBox<WString>::From(value.GetMutableBoxedValue().Obj())->value = L"xyz";
+			TEST_ASSERT(UnboxValue<WString>(value) == L"xyz");
+			TEST_ASSERT(UnboxValue<WString>(other) == L"abc");
+		}
+		{
+			Value value = BoxValue<Point>({ 10, 20 });
+			TEST_EXCEPTION(UnboxValue<Size>(value), ArgumentTypeMismtatchException, [](auto) {});
+			TEST_EXCEPTION(UnboxValue<Point>(BoxValue<vint>(1)), ArgumentTypeMismtatchException, [](auto) {});
+			TEST_EXCEPTION(UnboxValue<Point>(BoxValue<WString>(L"abc")), ArgumentTypeMismtatchException, [](auto) {});
+		}
 	}
 
 	void TestReflectionList()
@@ -595,6 +679,721 @@ namespace reflection_test
 		TEST_ASSERT(0 == UnboxValue<vint>(map.GetProperty(L"Count")));
 	}
 
+	class LateTypeDescriptor : public TypeDescriptorImpl
+	{
+	protected:
+		ITypeDescriptor*				loadingBaseType;
+
+		void LoadInternal()override
+		{
+			if (loadingBaseType)
+			{
+				AddBaseType(loadingBaseType);
+			}
+		}
+	public:
+		static const TypeInfoContent	content;
+		static const TypeInfoContent	derivedContent;
+
+		LateTypeDescriptor(const TypeInfoContent* _content, ITypeDescriptor* _loadingBaseType = nullptr)
+			:TypeDescriptorImpl(TypeDescriptorFlags::Class, _content)
+			, loadingBaseType(_loadingBaseType)
+		{
+		}
+
+		void AddLateBaseType(ITypeDescriptor* value)
+		{
+			AddBaseType(value);
+		}
+	};
+	const TypeInfoContent LateTypeDescriptor::content = { L"reflection_test::Late", nullptr, TypeInfoContent::CppType };
+	const TypeInfoContent LateTypeDescriptor::derivedContent = { L"reflection_test::LateDerived", nullptr, TypeInfoContent::CppType };
+
+	void TestMemberLookup()
+	{
+		auto tdBase = GetTypeDescriptor<Base>();
+		auto tdDerived = GetTypeDescriptor<Derived>();
+
+		auto a = tdBase->GetPropertyByName(L"a", false);
+		TEST_ASSERT(a != nullptr);
+		TEST_ASSERT(a->GetOwnerTypeDescriptor() == tdBase);
+		TEST_ASSERT(tdDerived->GetPropertyByName(L"a", true) == a);
+		TEST_ASSERT(tdDerived->GetPropertyByName(L"a", false) == nullptr);
+		TEST_ASSERT(tdDerived->IsPropertyExists(L"a", true));
+		TEST_ASSERT(!tdDerived->IsPropertyExists(L"a", false));
+
+		auto b = tdDerived->GetPropertyByName(L"b", false);
+		TEST_ASSERT(b != nullptr);
+		TEST_ASSERT(tdDerived->GetPropertyByName(L"b", true) == b);
+		TEST_ASSERT(tdBase->GetPropertyByName(L"b", true) == nullptr);
+		TEST_ASSERT(tdDerived->GetPropertyByName(L"NotExists", true) == nullptr);
+
+		auto reset = tdDerived->GetMethodGroupByName(L"Reset", false);
+		TEST_ASSERT(reset != nullptr);
+		TEST_ASSERT(tdDerived->GetMethodGroupByName(L"Reset", true) == reset);
+		TEST_ASSERT(tdDerived->IsMethodGroupExists(L"Reset", false));
+		TEST_ASSERT(!tdBase->IsMethodGroupExists(L"Reset", true));
+		TEST_ASSERT(!tdDerived->IsEventExists(L"NotExists", true));
+
+		auto tdObject = GetTypeDescriptor<DescriptableObject>();
+		TEST_ASSERT(tdDerived->CanConvertTo(tdDerived));
+		TEST_ASSERT(tdDerived->CanConvertTo(tdBase));
+		TEST_ASSERT(tdDerived->CanConvertTo(tdObject));
+		TEST_ASSERT(tdBase->CanConvertTo(tdObject));
+		TEST_ASSERT(!tdBase->CanConvertTo(tdDerived));
+		TEST_ASSERT(!tdObject->CanConvertTo(tdBase));
+		TEST_ASSERT(!tdDerived->CanConvertTo(GetTypeDescriptor<IValueList>()));
+
+		{
+			// a base type added after loading is visible to the type and its loaded sub types
+			auto tdLate = Ptr(new LateTypeDescriptor(&LateTypeDescriptor::content));
+			auto tdLateDerived = Ptr(new LateTypeDescriptor(&LateTypeDescriptor::derivedContent, tdLate.Obj()));
+			TEST_ASSERT(tdLateDerived->CanConvertTo(tdLate.Obj()));
+			TEST_ASSERT(!tdLateDerived->CanConvertTo(tdBase));
+			TEST_ASSERT(tdLateDerived->GetPropertyByName(L"a", true) == nullptr);
+			TEST_ASSERT(!tdDerived->CanConvertTo(tdLate.Obj()));
+
+			tdLate->AddLateBaseType(tdBase);
+			TEST_ASSERT(tdLate->CanConvertTo(tdBase));
+			TEST_ASSERT(tdLateDerived->CanConvertTo(tdBase));
+			TEST_ASSERT(tdLateDerived->CanConvertTo(tdObject));
+			TEST_ASSERT(tdLateDerived->GetPropertyByName(L"a", true) == a);
+			TEST_ASSERT(tdLateDerived->GetPropertyByName(L"a", false) == nullptr);
+
+			// types not deriving from the modified type keep using their lookup tables
+			TEST_ASSERT(tdDerived->GetPropertyByName(L"a", true) == a);
+			TEST_ASSERT(!tdDerived->CanConvertTo(tdLate.Obj()));
+		}
+
+		auto derived = Ptr(new Derived);
+		Array<Value> optionArguments(1), derivedArguments(1), stringArguments(1);
+		optionArguments[0] = BoxValue(ResetA);
+		derivedArguments[0] = BoxValue(derived);
+		stringArguments[0] = BoxValue(WString(L"ResetA"));
+
+		IMethodInfo* resetOption = nullptr;
+		IMethodInfo* resetDerived = nullptr;
+		for (vint i = 0; i < reset->GetMethodCount(); i++)
+		{
+			auto method = reset->GetMethod(i);
+			if (method->GetParameterCount() != 1) continue;
+			if (method->GetParameter(0)->GetType()->GetTypeDescriptor() == GetTypeDescriptor<ResetOption>())
+			{
+				resetOption = method;
+			}
+			else
+			{
+				resetDerived = method;
+			}
+		}
+		TEST_ASSERT(resetOption && resetDerived);
+		TEST_ASSERT(resetOption->TryCheckArguments(optionArguments) == 0);
+		TEST_ASSERT(resetOption->TryCheckArguments(derivedArguments) == -1);
+		TEST_ASSERT(resetDerived->TryCheckArguments(derivedArguments) == 0);
+		TEST_ASSERT(resetDerived->TryCheckArguments(optionArguments) == -1);
+		TEST_ASSERT(resetDerived->TryCheckArguments(stringArguments) == -1);
+
+		for (vint i = 0; i < 2; i++)
+		{
+			TEST_ASSERT(Value::SelectMethod(reset, optionArguments) == resetOption);
+			TEST_ASSERT(Value::SelectMethod(reset, derivedArguments) == resetDerived);
+		}
+	}
+
+	void TestInvokeWithoutAllocation()
+	{
+		auto derived = BoxValue(Ptr(new Derived));
+		WString nameSetB = WString::Unmanaged(L"SetB");
+		WString nameGetB = WString::Unmanaged(L"GetB");
+		WString nameReset = WString::Unmanaged(L"Reset");
+		Value setBArguments[] = { BoxValue<vint>(10) };
+		Value resetArguments[] = { BoxValue<vint>(1), BoxValue<vint>(2) };
+
+		// warm up lazily created caches
+		derived.Invoke(nameSetB, setBArguments);
+		derived.Invoke(nameGetB);
+		derived.Invoke(nameReset, resetArguments);
+
+		{
+			AllocationCounter counter;
+			derived.Invoke(nameSetB, setBArguments);
+			auto b = derived.Invoke(nameGetB);
+			derived.Invoke(nameReset, resetArguments);
+			auto b2 = derived.Invoke(nameGetB);
+
+			TEST_ASSERT(counter.Count() == 0);
+			TEST_ASSERT(UnboxValue<vint>(b) == 10);
+			TEST_ASSERT(UnboxValue<vint>(b2) == 2);
+		}
+		{
+#ifdef ALLOCATION_COUNTER_COUNTS_HEAP
+			// building an argument array for each call, which Value::Invoke did before taking ValueSpan, is counted
+			AllocationCounter counter;
+			Array<Value> arguments(1);
+			arguments[0] = setBArguments[0];
+			derived.Invoke(nameSetB, arguments);
+			TEST_ASSERT(counter.Count() > 0);
+#endif
+		}
+
+		Value wrongArguments[] = { BoxValue(WString(L"10")) };
+		TEST_EXCEPTION(derived.Invoke(nameSetB, wrongArguments), ArgumentTypeMismtatchException, [](const ArgumentTypeMismtatchException& e)
+		{
+			TEST_ASSERT(INVLOC.FindFirst(e.Message(), GetTypeDescriptor<vint>()->GetTypeName(), Locale::None).key != -1);
+		});
+
+		Array<Value> arguments(1);
+		arguments[0] = BoxValue<vint>(20);
+		derived.Invoke(nameSetB, arguments);
+		TEST_ASSERT(UnboxValue<vint>(derived.GetProperty(L"b")) == 20);
+	}
+
+	void TestInvokeUnchecked()
+	{
+		auto tdDerived = GetTypeDescriptor<Derived>();
+		auto derived = BoxValue(Ptr(new Derived));
+
+		auto setB = tdDerived->GetMethodGroupByName(L"SetB", false)->GetMethod(0);
+		auto getB = tdDerived->GetMethodGroupByName(L"GetB", false)->GetMethod(0);
+		Value arguments[] = { BoxValue<vint>(10) };
+		TEST_ASSERT(setB->InvokeUnchecked(derived, arguments).IsNull());
+		TEST_ASSERT(UnboxValue<vint>(getB->InvokeUnchecked(derived, {})) == 10);
+
+		auto create = tdDerived->GetMethodGroupByName(L"Create", false);
+		for (vint i = 0; i < create->GetMethodCount(); i++)
+		{
+			auto method = create->GetMethod(i);
+			if (method->GetParameterCount() == 2)
+			{
+				Value createArguments[] = { BoxValue<vint>(1), BoxValue<vint>(2) };
+				auto created = method->InvokeUnchecked(Value(), createArguments);
+				TEST_ASSERT(UnboxValue<vint>(created.GetProperty(L"b")) == 2);
+			}
+		}
+
+		auto b = tdDerived->GetPropertyByName(L"b", false);
+		b->SetValueUnchecked(derived, BoxValue<vint>(20));
+		TEST_ASSERT(UnboxValue<vint>(b->GetValueUnchecked(derived)) == 20);
+		TEST_ASSERT(UnboxValue<vint>(b->GetValue(derived)) == 20);
+
+		auto a = tdDerived->GetPropertyByName(L"a", true);
+		a->SetValueUnchecked(derived, BoxValue<vint>(30));
+		TEST_ASSERT(UnboxValue<vint>(a->GetValueUnchecked(derived)) == 30);
+		TEST_ASSERT(UnboxValue<vint>(a->GetValue(derived)) == 30);
+
+		auto point = BoxValue(Point{ 1,2 });
+		auto x = GetTypeDescriptor<Point>()->GetPropertyByName(L"x", false);
+		x->SetValueUnchecked(point, BoxValue<vint>(3));
+		TEST_ASSERT(UnboxValue<vint>(x->GetValueUnchecked(point)) == 3);
+		TEST_ASSERT(UnboxValue<Point>(point).y == 2);
+	}
+
+	void TestNativeInvoker()
+	{
+		auto tdBase = GetTypeDescriptor<Base>();
+		auto tdDerived = GetTypeDescriptor<Derived>();
+		auto derived = Ptr(new Derived);
+
+		auto setB = tdDerived->GetMethodGroupByName(L"SetB", false)->GetMethod(0);
+		auto getB = tdDerived->GetMethodGroupByName(L"GetB", false)->GetMethod(0);
+		TEST_ASSERT(!setB->GetNativeInvoker<void(Derived*, vint, vint)>());
+		TEST_ASSERT(!setB->GetNativeInvoker<void(Derived*, double)>());
+		TEST_ASSERT(!getB->GetNativeInvoker<vint()>());
+
+		auto nativeSetB = setB->GetNativeInvoker<void(Derived*, vint)>();
+		auto nativeGetB = getB->GetNativeInvoker<vint(Derived*)>();
+		TEST_ASSERT(nativeSetB && nativeGetB);
+		nativeSetB(derived.Obj(), 10);
+		TEST_ASSERT(nativeGetB(derived.Obj()) == 10);
+
+		{
+			auto reset = tdDerived->GetMethodGroupByName(L"Reset", false);
+			vint matched = 0;
+			for (vint i = 0; i < reset->GetMethodCount(); i++)
+			{
+				if (auto nativeReset = reset->GetMethod(i)->GetNativeInvoker<void(Derived*, Derived*)>())
+				{
+					auto source = Ptr(new Derived(1, 2));
+					nativeReset(derived.Obj(), source.Obj());
+					matched++;
+				}
+			}
+			TEST_ASSERT(matched == 1);
+			TEST_ASSERT(derived->a == 1);
+			TEST_ASSERT(derived->GetB() == 2);
+		}
+		{
+			auto create = tdDerived->GetMethodGroupByName(L"Create", false);
+			vint matched = 0;
+			for (vint i = 0; i < create->GetMethodCount(); i++)
+			{
+				if (auto nativeCreate = create->GetMethod(i)->GetNativeInvoker<Ptr<Derived>(vint, vint)>())
+				{
+					TEST_ASSERT(nativeCreate(3, 4)->GetB() == 4);
+					matched++;
+				}
+			}
+			TEST_ASSERT(matched == 1);
+		}
+		{
+			auto ctors = tdBase->GetConstructorGroup();
+			vint matched = 0;
+			for (vint i = 0; i < ctors->GetMethodCount(); i++)
+			{
+				if (auto nativeCtor = ctors->GetMethod(i)->GetNativeInvoker<Ptr<Base>(vint)>())
+				{
+					TEST_ASSERT(nativeCtor(5)->a == 5);
+					matched++;
+				}
+				else if (auto nativeCtor = ctors->GetMethod(i)->GetNativeInvoker<Ptr<Base>(vint, vint)>())
+				{
+					TEST_ASSERT(nativeCtor(5, 6)->a == 11);
+					matched++;
+				}
+			}
+			TEST_ASSERT(matched == 2);
+		}
+
+		auto b = tdDerived->GetPropertyByName(L"b", false);
+		TEST_ASSERT(!b->GetNativeGetter<WString(Derived*)>());
+		b->GetNativeSetter<void(Derived*, vint)>()(derived.Obj(), 20);
+		TEST_ASSERT(b->GetNativeGetter<vint(Derived*)>()(derived.Obj()) == 20);
+
+		auto a = tdBase->GetPropertyByName(L"a", false);
+		TEST_ASSERT(!a->GetNativeSetter<void(Base*, vint)>());
+		a->GetNativeSetter<void(Base*, const vint&)>()(derived.Obj(), 30);
+		TEST_ASSERT(a->GetNativeGetter<vint(Base*)>()(derived.Obj()) == 30);
+
+		Point point{ 1,2 };
+		auto x = GetTypeDescriptor<Point>()->GetPropertyByName(L"x", false);
+		x->GetNativeSetter<void(Point*, const vint&)>()(&point, 3);
+		TEST_ASSERT(x->GetNativeGetter<vint(Point*)>()(&point) == 3);
+		TEST_ASSERT(point.y == 2);
+	}
+
+	void TestCallSite()
+	{
+		auto base = BoxValue(Ptr(new Base(1)));
+		auto derived = BoxValue(Ptr(new Derived(2, 3)));
+
+		ValueCallSite getA(L"a");
+		for (vint i = 0; i < 3; i++)
+		{
+			TEST_ASSERT(UnboxValue<vint>(getA.GetProperty(base)) == 1);
+			TEST_ASSERT(UnboxValue<vint>(getA.GetProperty(derived)) == 2);
+		}
+
+		ValueCallSite setB(L"b");
+		setB.SetProperty(derived, BoxValue<vint>(4));
+		TEST_ASSERT(UnboxValue<vint>(setB.GetProperty(derived)) == 4);
+		TEST_EXCEPTION(setB.GetProperty(base), MemberNotExistsException, [](auto&&) {});
+		TEST_EXCEPTION(setB.GetProperty(Value()), ArgumentNullException, [](auto&&) {});
+
+		ValueCallSite reset(L"Reset", 2);
+		Value resetArguments[] = { BoxValue<vint>(5), BoxValue<vint>(6) };
+		for (vint i = 0; i < 3; i++)
+		{
+			reset.Invoke(derived, resetArguments);
+		}
+		TEST_ASSERT(UnboxValue<vint>(getA.GetProperty(derived)) == 5);
+		TEST_ASSERT(UnboxValue<vint>(setB.GetProperty(derived)) == 6);
+
+		Value resetOptionArguments[] = { BoxValue(ResetA) };
+		reset.Invoke(derived, resetOptionArguments);
+		TEST_ASSERT(UnboxValue<vint>(getA.GetProperty(derived)) == 0);
+		TEST_ASSERT(UnboxValue<vint>(setB.GetProperty(derived)) == 6);
+
+		ValueCallSite getB(L"GetB");
+		TEST_ASSERT(UnboxValue<vint>(getB.Invoke(derived, {})) == 6);
+	}
+
+	void TestConstructorSite()
+	{
+		PooledNode::allocatedCount = 0;
+		{
+			ValueConstructorSite site(L"PooledNode", 1);
+			TEST_ASSERT(site.GetTypeDescriptor() == GetTypeDescriptor<PooledNode>());
+			for (vint i = 0; i < 3; i++)
+			{
+				Value arguments[] = { BoxValue<vint>(i) };
+				auto node = site.Create(ValueSpan(arguments));
+				TEST_ASSERT(UnboxValue<Ptr<PooledNode>>(node)->value == i);
+			}
+			TEST_ASSERT(UnboxValue<Ptr<PooledNode>>(site.Create(ValueSpan()))->value == 0);
+		}
+		TEST_ASSERT(UnboxValue<Ptr<PooledNode>>(Value::Create(L"PooledNode"))->value == 0);
+		TEST_ASSERT(PooledNode::allocatedCount == 5);
+
+		{
+			auto ctor = GetTypeDescriptor<PooledNode>()->GetConstructorGroup()->GetMethod(1);
+			auto create = ctor->GetNativeInvoker<Ptr<PooledNode>(vint)>();
+			TEST_ASSERT(create(10)->value == 10);
+			TEST_ASSERT(PooledNode::allocatedCount == 6);
+		}
+		{
+			ValueConstructorSite site(L"Derived", 2);
+			Value arguments[] = { BoxValue<vint>(1), BoxValue<vint>(2) };
+			auto derived = site.Create(ValueSpan(arguments));
+			TEST_ASSERT(UnboxValue<vint>(derived.GetProperty(L"a")) == 1);
+			TEST_ASSERT(UnboxValue<vint>(derived.GetProperty(L"b")) == 2);
+		}
+		{
+			ValueConstructorSite site(L"NotExistingType");
+			TEST_EXCEPTION(site.Create(ValueSpan()), TypeNotExistsException, [](auto&&) {});
+		}
+	}
+
+	void TestConcurrentLoading()
+	{
+		const wchar_t* typeNames[] = { L"Derived", L"Base", L"BaseSummer", L"DictionaryHolder", L"Rect", L"Season", L"system::ReadonlyList", L"system::List" };
+		const vint TypeCount = sizeof(typeNames) / sizeof(*typeNames);
+		const vint ThreadCount = 8;
+
+		// types are not loaded until their members are accessed
+		ITypeDescriptor* types[TypeCount];
+		for (vint i = 0; i < TypeCount; i++)
+		{
+			types[i] = GetTypeDescriptor(WString::Unmanaged(typeNames[i]));
+			TEST_ASSERT(types[i] != nullptr);
+		}
+
+		struct Result
+		{
+			vint						propertyCount = -1;
+			vint						methodGroupCount = -1;
+			IMethodGroupInfo*			constructorGroup = nullptr;
+			IMethodGroupInfo*			firstMethodGroup = nullptr;
+		};
+		Result results[ThreadCount][TypeCount];
+
+		atomic_vint ready = 0;
+		Thread* threads[ThreadCount];
+		for (vint t = 0; t < ThreadCount; t++)
+		{
+			threads[t] = Thread::CreateAndStart([&, t]()
+			{
+				ready++;
+				while (ready != ThreadCount);
+				for (vint i = 0; i < TypeCount; i++)
+				{
+					// threads visit types in different orders, to load base types and derived types concurrently
+					vint index = (i + t) % TypeCount;
+					auto type = types[index];
+					auto& result = results[t][index];
+					result.propertyCount = type->GetPropertyCount();
+					result.methodGroupCount = type->GetMethodGroupCount();
+					result.constructorGroup = type->GetConstructorGroup();
+					if (result.methodGroupCount > 0)
+					{
+						result.firstMethodGroup = type->GetMethodGroupByName(type->GetMethodGroup(0)->GetName(), true);
+					}
+				}
+			}, false);
+		}
+		for (vint t = 0; t < ThreadCount; t++)
+		{
+			threads[t]->Wait();
+			delete threads[t];
+		}
+
+		for (vint i = 0; i < TypeCount; i++)
+		{
+			auto type = types[i];
+			for (vint t = 0; t < ThreadCount; t++)
+			{
+				auto& result = results[t][i];
+				TEST_ASSERT(result.propertyCount == type->GetPropertyCount());
+				TEST_ASSERT(result.methodGroupCount == type->GetMethodGroupCount());
+				TEST_ASSERT(result.constructorGroup == type->GetConstructorGroup());
+				TEST_ASSERT(result.firstMethodGroup == (type->GetMethodGroupCount() > 0 ? type->GetMethodGroup(0) : nullptr));
+			}
+		}
+	}
+
+	void TestPreloadRegisteredTypes()
+	{
+		auto tm = GetGlobalTypeManager();
+		TypePreloadingStatistics statistics;
+		TEST_ERROR(PreloadRegisteredTypes(0, statistics));
+		PreloadRegisteredTypes(4, statistics);
+		TEST_ASSERT(statistics.types.Count() == tm->GetTypeDescriptorCount());
+
+		for (vint i = 0; i < statistics.types.Count(); i++)
+		{
+			TEST_ASSERT(statistics.types[i].type == tm->GetTypeDescriptor(i));
+		}
+
+		auto derived = GetTypeDescriptor(WString::Unmanaged(L"Derived"));
+		TEST_ASSERT(derived->GetBaseTypeDescriptorCount() == 1);
+		TEST_ASSERT(derived->GetBaseTypeDescriptor(0) == GetTypeDescriptor(WString::Unmanaged(L"Base")));
+		TEST_ASSERT(derived->GetPropertyByName(WString::Unmanaged(L"a"), true) != nullptr);
+		TEST_ASSERT(derived->GetPropertyByName(WString::Unmanaged(L"b"), false) != nullptr);
+
+		// types are already loaded, loading them again costs nearly nothing
+		TypePreloadingStatistics again;
+		PreloadRegisteredTypes(64, again);
+		TEST_ASSERT(again.types.Count() == statistics.types.Count());
+	}
+
+	struct SyntheticTypeName
+	{
+		WString								name;
+		TypeInfoContent						content;
+
+		SyntheticTypeName(const WString& _name)
+			:name(_name)
+			, content{ name.Buffer(), nullptr, TypeInfoContent::CppType }
+		{
+		}
+	};
+
+	class SyntheticTypeDescriptor : private SyntheticTypeName, public ValueTypeDescriptorBase
+	{
+	public:
+		SyntheticTypeDescriptor(const WString& name)
+			:SyntheticTypeName(name)
+			, ValueTypeDescriptorBase(TypeDescriptorFlags::Primitive, &content)
+		{
+		}
+	};
+
+	void TestBatchTypeRegistration()
+	{
+		const vint SyntheticTypeCount = 50000;
+		auto tm = GetGlobalTypeManager();
+		vint oldCount = tm->GetTypeDescriptorCount();
+		vint oldVersion = tm->GetTypeVersion();
+		auto derived = tm->GetTypeDescriptor(WString::Unmanaged(L"Derived"));
+
+		List<Ptr<ITypeDescriptor>> types;
+		for (vint i = SyntheticTypeCount - 1; i >= 0; i--)
+		{
+			types.Add(Ptr(new SyntheticTypeDescriptor(L"synthetic::Type" + itow(i))));
+		}
+		types.Add(Ptr(new SyntheticTypeDescriptor(WString::Unmanaged(L"synthetic::Type0"))));
+		types.Add(nullptr);
+		types.Add(Ptr(new SyntheticTypeDescriptor(WString::Unmanaged(L"Derived"))));
+
+		TEST_ASSERT(tm->SetTypeDescriptors(types) == SyntheticTypeCount);
+		TEST_ASSERT(tm->GetTypeDescriptorCount() == oldCount + SyntheticTypeCount);
+		TEST_ASSERT(tm->GetTypeVersion() == oldVersion + 1);
+		TEST_ASSERT(tm->GetTypeDescriptor(WString::Unmanaged(L"Derived")) == derived);
+		TEST_ASSERT(tm->GetTypeDescriptor(WString::Unmanaged(L"synthetic::Type0")) == types[SyntheticTypeCount - 1].Obj());
+		TEST_ASSERT(tm->GetTypeDescriptor(WString::Unmanaged(L"synthetic::Type12345")) == types[SyntheticTypeCount - 12346].Obj());
+
+		for (vint i = 1; i < tm->GetTypeDescriptorCount(); i++)
+		{
+			TEST_ASSERT(tm->GetTypeDescriptor(i - 1)->GetTypeName() < tm->GetTypeDescriptor(i)->GetTypeName());
+		}
+
+		// registering the same types again changes nothing
+		TEST_ASSERT(tm->SetTypeDescriptors(types) == 0);
+		TEST_ASSERT(tm->GetTypeDescriptorCount() == oldCount + SyntheticTypeCount);
+		TEST_ASSERT(tm->GetTypeVersion() == oldVersion + 1);
+
+		TEST_ASSERT(tm->SetTypeDescriptor(WString::Unmanaged(L"synthetic::Type0"), nullptr));
+		TEST_ASSERT(tm->GetTypeDescriptor(WString::Unmanaged(L"synthetic::Type0")) == nullptr);
+		TEST_ASSERT(tm->SetTypeDescriptors(types) == 1);
+		TEST_ASSERT(tm->GetTypeDescriptor(WString::Unmanaged(L"synthetic::Type0")) == types[SyntheticTypeCount - 1].Obj());
+	}
+
+	class SyntheticTypeLoader : public Object, public ITypeLoader
+	{
+	public:
+		List<Ptr<ITypeDescriptor>>			types;
+		bool								visibleInLoader = false;
+
+		void Load(ITypeManager* manager)override
+		{
+			manager->SetTypeDescriptors(types);
+			visibleInLoader = manager->GetTypeDescriptor(types[0]->GetTypeName()) == types[0].Obj();
+		}
+
+		void Unload(ITypeManager* manager)override
+		{
+			for (vint i = 0; i < types.Count(); i++)
+			{
+				manager->SetTypeDescriptor(types[i]->GetTypeName(), nullptr);
+			}
+		}
+	};
+
+	void TestConcurrentTypeNameLookup()
+	{
+		const vint ThreadCount = 4;
+		const vint RoundCount = 200;
+		auto tm = GetGlobalTypeManager();
+		auto derived = tm->GetTypeDescriptor(WString::Unmanaged(L"Derived"));
+		TEST_ASSERT(derived != nullptr);
+		TEST_ASSERT(tm->GetTypeDescriptor(WString::Empty) == nullptr);
+		TEST_ASSERT(tm->GetTypeDescriptor(WString::Unmanaged(L"Derived2")) == nullptr);
+		for (vint i = 0; i < tm->GetTypeDescriptorCount(); i++)
+		{
+			auto type = tm->GetTypeDescriptor(i);
+			TEST_ASSERT(tm->GetTypeDescriptor(type->GetTypeName()) == type);
+		}
+
+		List<Ptr<ITypeDescriptor>> types;
+		for (vint i = 0; i < RoundCount; i++)
+		{
+			types.Add(Ptr(new SyntheticTypeDescriptor(L"synthetic::Round" + itow(i))));
+		}
+
+		atomic_vint ready = 0;
+		std::atomic<bool> stopping = false;
+		atomic_vint errors = 0;
+		Thread* threads[ThreadCount];
+		for (vint t = 0; t < ThreadCount; t++)
+		{
+			threads[t] = Thread::CreateAndStart([&]()
+			{
+				ready++;
+				while (!stopping)
+				{
+					if (tm->GetTypeDescriptor(WString::Unmanaged(L"Derived")) != derived) errors++;
+					for (vint i = 0; i < RoundCount; i++)
+					{
+						auto type = tm->GetTypeDescriptor(types[i]->GetTypeName());
+						if (type && type != types[i].Obj()) errors++;
+					}
+				}
+			}, false);
+		}
+		while (ready != ThreadCount);
+
+		// registering types one by one, in batches and through type loaders all republish the index
+		for (vint i = 0; i < RoundCount; i += 4)
+		{
+			TEST_ASSERT(tm->SetTypeDescriptor(types[i]->GetTypeName(), types[i]));
+			TEST_ASSERT(tm->GetTypeDescriptor(types[i]->GetTypeName()) == types[i].Obj());
+
+			List<Ptr<ITypeDescriptor>> batch;
+			batch.Add(types[i + 1]);
+			TEST_ASSERT(tm->SetTypeDescriptors(batch) == 1);
+			TEST_ASSERT(tm->GetTypeDescriptor(types[i + 1]->GetTypeName()) == types[i + 1].Obj());
+
+			auto loader = Ptr(new SyntheticTypeLoader);
+			loader->types.Add(types[i + 2]);
+			loader->types.Add(types[i + 3]);
+			TEST_ASSERT(tm->AddTypeLoader(loader));
+			TEST_ASSERT(loader->visibleInLoader);
+			TEST_ASSERT(tm->GetTypeDescriptor(types[i + 3]->GetTypeName()) == types[i + 3].Obj());
+
+			TEST_ASSERT(tm->RemoveTypeLoader(loader));
+			TEST_ASSERT(tm->GetTypeDescriptor(types[i + 2]->GetTypeName()) == nullptr);
+			TEST_ASSERT(tm->GetTypeDescriptor(types[i + 3]->GetTypeName()) == nullptr);
+		}
+
+		stopping = true;
+		for (vint t = 0; t < ThreadCount; t++)
+		{
+			threads[t]->Wait();
+			delete threads[t];
+		}
+		TEST_ASSERT(errors == 0);
+	}
+
+	void TestCachedTypeDescriptor()
+	{
+		const vint ThreadCount = 16;
+		const vint CallCount = 100000;
+		auto tm = GetGlobalTypeManager();
+		auto vintType = GetTypeDescriptor(WString::Unmanaged(L"system::Int64"));
+		TEST_ASSERT(GetTypeDescriptor<vint>() == vintType);
+		TEST_ASSERT(GetTypeDescriptor<Derived>() == GetTypeDescriptor(WString::Unmanaged(L"Derived")));
+		TEST_ASSERT(GetTypeDescriptor<SwappableType>() == nullptr);
+
+		// the cached type is refreshed once the type version changes
+		Ptr<ITypeDescriptor> swappables[] = {
+			Ptr(new SyntheticTypeDescriptor(WString::Unmanaged(L"synthetic::SwappableType"))),
+			Ptr(new SyntheticTypeDescriptor(WString::Unmanaged(L"synthetic::SwappableType")))
+		};
+		TEST_ASSERT(tm->SetTypeDescriptor(swappables[0]->GetTypeName(), swappables[0]));
+		TEST_ASSERT(GetTypeDescriptor<SwappableType>() == swappables[0].Obj());
+		TEST_ASSERT(tm->SetTypeDescriptor(swappables[0]->GetTypeName(), nullptr));
+		TEST_ASSERT(GetTypeDescriptor<SwappableType>() == nullptr);
+		TEST_ASSERT(tm->SetTypeDescriptor(swappables[1]->GetTypeName(), swappables[1]));
+		TEST_ASSERT(GetTypeDescriptor<SwappableType>() == swappables[1].Obj());
+		TEST_ASSERT(tm->SetTypeDescriptor(swappables[1]->GetTypeName(), nullptr));
+		TEST_ASSERT(GetTypeDescriptor<SwappableType>() == nullptr);
+
+		// every registration or unregistration increases the version by one, starting from an unregistered state:
+		// version % 4 == 1 -> swappables[0], version % 4 == 3 -> swappables[1], otherwise -> null
+		vint baseVersion = tm->GetTypeVersion();
+		auto expected = [&](vint version) -> ITypeDescriptor*
+		{
+			switch ((version - baseVersion) % 4)
+			{
+			case 1: return swappables[0].Obj();
+			case 3: return swappables[1].Obj();
+			default: return nullptr;
+			}
+		};
+
+		atomic_vint ready = 0;
+		std::atomic<bool> stopping = false;
+		atomic_vint errors = 0;
+		Thread* threads[ThreadCount];
+		for (vint t = 0; t < ThreadCount; t++)
+		{
+			threads[t] = Thread::CreateAndStart([&]()
+			{
+				ready++;
+				for (vint i = 0; i < CallCount; i++)
+				{
+					if (GetTypeDescriptor<vint>() != vintType) errors++;
+				}
+
+				while (!stopping)
+				{
+					// a lookup racing with a registration may see the type before the version increases
+					auto version1 = tm->GetTypeVersion();
+					auto type = GetTypeDescriptor<SwappableType>();
+					auto version2 = tm->GetTypeVersion();
+					if (version1 == version2 && type != expected(version1) && type != expected(version1 + 1)) errors++;
+				}
+			}, false);
+		}
+		while (ready != ThreadCount);
+
+		for (vint i = 0; i < 1000; i++)
+		{
+			auto swappable = swappables[i % 2];
+			TEST_ASSERT(tm->SetTypeDescriptor(swappable->GetTypeName(), swappable));
+			TEST_ASSERT(GetTypeDescriptor<SwappableType>() == swappable.Obj());
+			TEST_ASSERT(tm->SetTypeDescriptor(swappable->GetTypeName(), nullptr));
+			TEST_ASSERT(GetTypeDescriptor<SwappableType>() == nullptr);
+		}
+
+		stopping = true;
+		for (vint t = 0; t < ThreadCount; t++)
+		{
+			threads[t]->Wait();
+			delete threads[t];
+		}
+		TEST_ASSERT(errors == 0);
+	}
+
+	void TestCachedTypeDescriptorAfterUnload()
+	{
+		// this test unloads the global type manager, it runs after all other test cases in this file
+		auto tm = GetGlobalTypeManager();
+		auto vintType = GetTypeDescriptor<vint>();
+		TEST_ASSERT(vintType != nullptr);
+
+		// an unloaded type manager is loaded, the same as looking up a type by name
+		TEST_ASSERT(tm->Unload());
+		TEST_ASSERT(!tm->IsLoaded());
+		auto reloadedType = GetTypeDescriptor<vint>();
+		TEST_ASSERT(tm->IsLoaded());
+		TEST_ASSERT(reloadedType != nullptr);
+		TEST_ASSERT(reloadedType == GetTypeDescriptor(WString::Unmanaged(L"system::Int64")));
+
+		// all type loaders are loaded again, cached types are refreshed
+		TEST_ASSERT(GetTypeDescriptor<Derived>() != nullptr);
+		TEST_ASSERT(GetTypeDescriptor<Derived>() == GetTypeDescriptor(WString::Unmanaged(L"Derived")));
+	}
+
 	void TestSharedRawPtrConverting()
 	{
 		Base* b1 = new Base;
@@ -643,23 +1442,200 @@ namespace reflection_test
 	{
 	public:
 		IMethodInfo* lastMethodInfo = nullptr;
+		Ptr<IValueReadonlyList> lastArguments;
+		Value result;
 
 		Value Invoke(IMethodInfo* methodInfo, Ptr<IValueReadonlyList> arguments)
 		{
 			lastMethodInfo = methodInfo;
-			return Value();
+			lastArguments = arguments;
+			return result;
+		}
+	};
+
+	class SpanInterfaceProxy : public Object, public IValueInterfaceProxy
+	{
+	public:
+		IMethodInfo* lastMethodInfo = nullptr;
+		Value lastArgument;
+		Value result = BoxValue<vint>(1);
+
+		Value Invoke(IMethodInfo* methodInfo, Ptr<IValueReadonlyList> arguments)override
+		{
+			CHECK_FAIL(L"This function should not be called.");
+		}
+
+		Value InvokeInPlace(IMethodInfo* methodInfo, ValueSpan arguments)override
+		{
+			lastMethodInfo = methodInfo;
+			lastArgument = arguments[0];
+			return result;
 		}
 	};
 
 	void TestInterfaceProxy()
 	{
-		auto mock = Ptr(new InterfaceProxy);
-		Ptr<IValueEnumerable> proxy = ValueInterfaceProxy<IValueEnumerable>::Create(mock);
-		proxy->CreateEnumerator();
+		{
+			// proxies of an interface that is not loaded are called concurrently, every call waits for the interface to load
+			const vint ThreadCount = 8;
+			Ptr<InterfaceProxy> mocks[ThreadCount];
+			vint results[ThreadCount];
+			Thread* threads[ThreadCount];
+			atomic_vint ready = 0;
+			for (vint t = 0; t < ThreadCount; t++)
+			{
+				mocks[t] = Ptr(new InterfaceProxy);
+				mocks[t]->result = BoxValue<vint>(t);
+				threads[t] = Thread::CreateAndStart([&, t]()
+				{
+					Ptr<IValueReadonlyList> proxy = ValueInterfaceProxy<IValueReadonlyList>::Create(mocks[t]);
+					ready++;
+					while (ready != ThreadCount);
+					results[t] = proxy->GetCount();
+				}, false);
+			}
+			for (vint t = 0; t < ThreadCount; t++)
+			{
+				threads[t]->Wait();
+				delete threads[t];
+			}
+
+			auto methodInfo = GetTypeDescriptor<IValueReadonlyList>()->GetMethodGroupByName(L"GetCount", false)->GetMethod(0);
+			for (vint t = 0; t < ThreadCount; t++)
+			{
+				TEST_ASSERT(results[t] == t);
+				TEST_ASSERT(mocks[t]->lastMethodInfo == methodInfo);
+			}
+		}
+		{
+			auto mock = Ptr(new InterfaceProxy);
+			Ptr<IValueEnumerable> proxy = ValueInterfaceProxy<IValueEnumerable>::Create(mock);
+			proxy->CreateEnumerator();
 
-		auto td = GetTypeDescriptor<IValueEnumerable>();
-		auto methodInfo = td->GetMethodGroupByName(L"CreateEnumerator", false)->GetMethod(0);
-		TEST_ASSERT(mock->lastMethodInfo == methodInfo);
+			auto td = GetTypeDescriptor<IValueEnumerable>();
+			auto methodInfo = td->GetMethodGroupByName(L"CreateEnumerator", false)->GetMethod(0);
+			TEST_ASSERT(mock->lastMethodInfo == methodInfo);
+			TEST_ASSERT(mock->lastArguments->GetCount() == 0);
+
+			// calls without arguments share the same empty list
+			auto emptyArguments = mock->lastArguments;
+			{
+				AllocationCounter counter;
+				InvokeInterfaceProxy(mock, methodInfo);
+				TEST_ASSERT(counter.Count() == 0);
+			}
+			TEST_ASSERT(mock->lastArguments == emptyArguments);
+		}
+		{
+			// temporary arguments are accepted
+			auto mock = Ptr(new InterfaceProxy);
+			auto methodInfo = GetTypeDescriptor<IValueReadonlyList>()->GetMethodGroupByName(L"Get", false)->GetMethod(0);
+			InvokeInterfaceProxy(mock, methodInfo, vint(10));
+			TEST_ASSERT(UnboxValue<vint>(mock->lastArguments->Get(0)) == 10);
+			InvokeInterfaceProxy(mock, methodInfo, BoxValue(WString(L"text")));
+			TEST_ASSERT(UnboxValue<WString>(mock->lastArguments->Get(0)) == L"text");
+		}
+		{
+			// a method inherited from a base interface resolves to the same method in proxies of different interfaces
+			auto methodInfo = GetTypeDescriptor<IValueEnumerable>()->GetMethodGroupByName(L"CreateEnumerator", false)->GetMethod(0);
+			auto mockEnumerable = Ptr(new InterfaceProxy);
+			auto mockList = Ptr(new InterfaceProxy);
+			Ptr<IValueEnumerable> proxyEnumerable = ValueInterfaceProxy<IValueEnumerable>::Create(mockEnumerable);
+			Ptr<IValueEnumerable> proxyList = ValueInterfaceProxy<IValueReadonlyList>::Create(mockList);
+			for (vint i = 0; i < 3; i++)
+			{
+				mockEnumerable->lastMethodInfo = nullptr;
+				mockList->lastMethodInfo = nullptr;
+				proxyEnumerable->CreateEnumerator();
+				proxyList->CreateEnumerator();
+				TEST_ASSERT(mockEnumerable->lastMethodInfo == methodInfo);
+				TEST_ASSERT(mockList->lastMethodInfo == methodInfo);
+			}
+		}
+		{
+			auto mock = Ptr(new InterfaceProxy);
+			Ptr<IValueReadonlyList> proxy = ValueInterfaceProxy<IValueReadonlyList>::Create(mock);
+			proxy->Get(10);
+
+			// arguments copied by the default implementation are still available after the call
+			auto arguments = mock->lastArguments;
+			mock->lastArguments = nullptr;
+			TEST_ASSERT(arguments->GetCount() == 1);
+			TEST_ASSERT(UnboxValue<vint>(arguments->Get(0)) == 10);
+			TEST_ASSERT(arguments->IndexOf(BoxValue<vint>(10)) == 0);
+			TEST_ASSERT(!arguments->Contains(BoxValue<vint>(11)));
+
+			auto enumerator = arguments->CreateEnumerator();
+			TEST_ASSERT(enumerator->Next());
+			TEST_ASSERT(UnboxValue<vint>(enumerator->GetCurrent()) == 10);
+			TEST_ASSERT(!enumerator->Next());
+		}
+		{
+			auto mock = Ptr(new InterfaceProxy);
+			Ptr<IValueReadonlyList> proxy = ValueInterfaceProxy<IValueReadonlyList>::Create(mock);
+			auto argument = BoxValue<vint>(10);
+			mock->result = BoxValue<bool>(true);
+			TEST_ASSERT(proxy->Contains(argument));
+
+			// a proxy that only accepts a list still receives the arguments
+			TEST_ASSERT(mock->lastArguments->GetCount() == 1);
+			TEST_ASSERT(UnboxValue<vint>(mock->lastArguments->Get(0)) == 10);
+		}
+		{
+			auto mock = Ptr(new SpanInterfaceProxy);
+			Ptr<IValueReadonlyList> proxy = ValueInterfaceProxy<IValueReadonlyList>::Create(mock);
+			auto methodInfo = GetTypeDescriptor<IValueReadonlyList>()->GetMethodGroupByName(L"IndexOf", false)->GetMethod(0);
+			auto argument = BoxValue<vint>(10);
+			TEST_ASSERT(proxy->IndexOf(argument) == 1);
+			TEST_ASSERT(mock->lastMethodInfo == methodInfo);
+
+			// arguments are passed in place to a proxy that accepts ValueSpan, the list overload fails the test if it is called
+			TEST_ASSERT(UnboxValue<vint>(mock->lastArgument) == 10);
+		}
+	}
+
+	class ComparerFunctionProxy : public Object, public IValueFunctionProxy
+	{
+	public:
+		ITypeDescriptor* vintType = description::GetTypeDescriptor<vint>();
+		vint calls = 0;
+
+		Value Invoke(Ptr<IValueReadonlyList> arguments)override
+		{
+			CHECK_FAIL(L"This function should not be called.");
+		}
+
+		Value InvokeInPlace(ValueSpan arguments)override
+		{
+			calls++;
+			if (arguments.Count() == 0) return Value();
+			auto a = UnboxValue<vint>(arguments[0], vintType);
+			auto b = UnboxValue<vint>(arguments[1], vintType);
+			return BoxValue<vint>(a - b, vintType);
+		}
+	};
+
+	void TestFunctionBridge()
+	{
+		auto proxy = Ptr(new ComparerFunctionProxy);
+		Value function = BoxValue<Ptr<IValueFunctionProxy>>(proxy);
+		{
+			auto comparer = UnboxParameter<Func<vint(vint, vint)>>(function);
+			TEST_ASSERT(comparer.Ref()(3, 1) == 2);
+
+			// arguments are passed in place to a proxy that accepts ValueSpan, the list overload fails the test if it is called
+			vint result = 0;
+			for (vint i = 0; i < 10; i++)
+			{
+				result += comparer.Ref()(i, 1);
+			}
+			TEST_ASSERT(result == 35);
+		}
+		{
+			auto callback = UnboxParameter<Func<void()>>(function);
+			callback.Ref()();
+		}
+		TEST_ASSERT(proxy->calls == 12);
 	}
 
 	void TestTypeInfoFriendlyName()
@@ -807,9 +1783,22 @@ TEST_FILE
 	TEST_CASE_REFLECTION(TestReflectionStruct)
 	TEST_CASE_REFLECTION(TestReflectionList)
 	TEST_CASE_REFLECTION(TestReflectionDictionary)
+	TEST_CASE_REFLECTION(TestMemberLookup)
+	TEST_CASE_REFLECTION(TestInvokeWithoutAllocation)
+	TEST_CASE_REFLECTION(TestInvokeUnchecked)
+	TEST_CASE_REFLECTION(TestNativeInvoker)
+	TEST_CASE_REFLECTION(TestCallSite)
+	TEST_CASE_REFLECTION(TestConstructorSite)
+	TEST_CASE_REFLECTION(TestConcurrentLoading)
+	TEST_CASE_REFLECTION(TestPreloadRegisteredTypes)
+	TEST_CASE_REFLECTION(TestBatchTypeRegistration)
+	TEST_CASE_REFLECTION(TestConcurrentTypeNameLookup)
+	TEST_CASE_REFLECTION(TestCachedTypeDescriptor)
 	TEST_CASE_REFLECTION(TestSharedRawPtrConverting)
 	TEST_CASE_REFLECTION(TestSharedRawPtrDestructing)
 	TEST_CASE_REFLECTION(TestInterfaceProxy)
+	TEST_CASE_REFLECTION(TestFunctionBridge)
 	TEST_CASE_REFLECTION(TestTypeInfoFriendlyName)
 	TEST_CASE_REFLECTION(TestCpp)
+	TEST_CASE_REFLECTION(TestCachedTypeDescriptorAfterUnload)
 }
@@ -107,6 +107,95 @@ namespace reflection_test_event
 
 		TEST_ASSERT(eventRaiser.DetachEvent(L"ValueChanged", eventHandler) == false);
 	}
+
+	class ListFunctionProxy : public Object, public IValueFunctionProxy
+	{
+	public:
+		Ptr<IValueReadonlyList> lastArguments;
+
+		Value Invoke(Ptr<IValueReadonlyList> arguments)override
+		{
+			lastArguments = arguments;
+			return Value();
+		}
+	};
+
+	class SpanFunctionProxy : public Object, public IValueFunctionProxy
+	{
+	public:
+		vint sum = 0;
+
+		Value Invoke(Ptr<IValueReadonlyList> arguments)override
+		{
+			CHECK_FAIL(L"This function should not be called.");
+		}
+
+		Value InvokeInPlace(ValueSpan arguments)override
+		{
+			sum += UnboxValue<vint>(arguments[0]) + UnboxValue<vint>(arguments[1]);
+			return Value();
+		}
+	};
+
+	void TestReflectionEventArguments()
+	{
+		auto raiser = Ptr(new EventRaiser);
+		Value eventRaiser = BoxValue(raiser);
+
+		{
+			auto proxy = Ptr(new ListFunctionProxy);
+			auto eventHandler = eventRaiser.AttachEvent(L"ValueChanged", BoxValue<Ptr<IValueFunctionProxy>>(proxy));
+			raiser->ValueChanged(1, 2);
+#ifdef ALLOCATION_COUNTER_COUNTS_HEAP
+			{
+				// building an argument list for each call, which every handler paid before ValueSpan, is counted
+				AllocationCounter counter;
+				raiser->ValueChanged(1, 2);
+				TEST_ASSERT(counter.Count() > 0);
+			}
+#endif
+			TEST_ASSERT(eventRaiser.DetachEvent(L"ValueChanged", eventHandler) == true);
+
+			// arguments copied for a handler that only accepts a list are still available after the call
+			TEST_ASSERT(proxy->lastArguments->GetCount() == 2);
+			TEST_ASSERT(UnboxValue<vint>(proxy->lastArguments->Get(0)) == 1);
+			TEST_ASSERT(UnboxValue<vint>(proxy->lastArguments->Get(1)) == 2);
+		}
+		{
+			vint sum = 0;
+			auto eventHandler = eventRaiser.AttachEvent(
+				L"ValueChanged",
+				BoxParameter(Func([&](vint oldValue, vint newValue)
+				{
+					sum += oldValue + newValue;
+				})));
+			raiser->ValueChanged(1, 2);
+			TEST_ASSERT(sum == 3);
+
+			AllocationCounter counter;
+			for (vint i = 0; i < 10; i++)
+			{
+				raiser->ValueChanged(i, i);
+			}
+			TEST_ASSERT(counter.Count() == 0);
+			TEST_ASSERT(sum == 93);
+			TEST_ASSERT(eventRaiser.DetachEvent(L"ValueChanged", eventHandler) == true);
+		}
+		{
+			// arguments are passed in place to a handler that accepts ValueSpan, the list overload fails the test if it is called
+			auto proxy = Ptr(new SpanFunctionProxy);
+			auto eventHandler = eventRaiser.AttachEvent(L"ValueChanged", BoxValue<Ptr<IValueFunctionProxy>>(proxy));
+			raiser->ValueChanged(1, 2);
+			TEST_ASSERT(proxy->sum == 3);
+			{
+				AllocationCounter counter;
+				raiser->ValueChanged(3, 4);
+				TEST_ASSERT(counter.Count() == 0);
+			}
+			TEST_ASSERT(proxy->sum == 10);
+			TEST_ASSERT(eventRaiser.DetachEvent(L"ValueChanged", eventHandler) == true);
+		}
+	}
 }
 using namespace reflection_test_event;
 
@@ -115,4 +204,5 @@ using namespace reflection_test_event;
 TEST_FILE
 {
 	TEST_CASE_REFLECTION(TestReflectionEvent)
+	TEST_CASE_REFLECTION(TestReflectionEventArguments)
 }